@@ -0,0 +1,453 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Times RAJA loops against the equivalent hand-written loops and fails when
+// a RAJA loop is slower than its raw loop by more than a threshold, so that
+// compilers or changes that stop inlining the RAJA abstractions are caught.
+//
+// The pairs cover forall over RangeSegment, RangeStrideSegment and
+// ListSegment, Views with Layout, OffsetLayout and permuted Layout, kernel
+// with 2 to 4 nested For statements, and reducers.  Each loop is repeated
+// and its best time kept, alternating raw and RAJA runs.
+//
+// Usage: abstraction-penalty [--threshold=<ratio>] [--repeats=<count>]
+//
+// The default threshold is 1.25, that is a RAJA loop may take at most 25%
+// longer than its raw loop.  The penalty is only meaningful for optimized
+// builds.
+//
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/util/Timer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#define N_1D (1 << 20)
+#define N_2D 1024
+#define N_3D 128
+#define N_4D 32
+
+using exec_policy = RAJA::loop_exec;
+using reduce_policy = RAJA::seq_reduce;
+
+struct Comparison {
+  std::string name;
+  double raw_time;
+  double raja_time;
+
+  double ratio() const { return raw_time > 0.0 ? raja_time / raw_time : 1.0; }
+};
+
+static int repeats = 20;
+static std::vector<Comparison> comparisons;
+
+template <typename Loop>
+static double time_once(Loop&& loop)
+{
+  RAJA::Timer timer;
+  timer.start();
+  loop();
+  timer.stop();
+  return timer.elapsed();
+}
+
+template <typename RawLoop, typename RajaLoop>
+static void compare(const char* name, RawLoop&& raw, RajaLoop&& raja)
+{
+  // warm up caches and pages
+  raw();
+  raja();
+
+  double raw_time = std::numeric_limits<double>::max();
+  double raja_time = std::numeric_limits<double>::max();
+  for (int r = 0; r < repeats; ++r) {
+    raw_time = std::min(raw_time, time_once(raw));
+    raja_time = std::min(raja_time, time_once(raja));
+  }
+  comparisons.push_back(Comparison{name, raw_time, raja_time});
+}
+
+static void compare_forall()
+{
+  const RAJA::Index_type n = N_1D;
+  std::vector<double> xv(n, 1.0), yv(n, 0.0);
+  double* x = &xv[0];
+  double* y = &yv[0];
+  const double a = 0.5;
+
+  compare("forall RangeSegment",
+          [=]() {
+            for (RAJA::Index_type i = 0; i < n; ++i) {
+              y[i] += a * x[i];
+            }
+          },
+          [=]() {
+            RAJA::forall<exec_policy>(RAJA::RangeSegment(0, n),
+                                      [=](RAJA::Index_type i) {
+                                        y[i] += a * x[i];
+                                      });
+          });
+
+  compare("forall RangeStrideSegment",
+          [=]() {
+            for (RAJA::Index_type i = 0; i < n; i += 2) {
+              y[i] += a * x[i];
+            }
+          },
+          [=]() {
+            RAJA::forall<exec_policy>(RAJA::RangeStrideSegment(0, n, 2),
+                                      [=](RAJA::Index_type i) {
+                                        y[i] += a * x[i];
+                                      });
+          });
+
+  std::vector<RAJA::Index_type> indices(n);
+  std::iota(indices.begin(), indices.end(), 0);
+  std::shuffle(indices.begin(), indices.end(), std::mt19937(12345));
+  const RAJA::Index_type* idx = &indices[0];
+  camp::resources::Resource host_res{camp::resources::Host()};
+  RAJA::ListSegment list(idx, n, host_res);
+
+  compare("forall ListSegment",
+          [=]() {
+            for (RAJA::Index_type l = 0; l < n; ++l) {
+              RAJA::Index_type i = idx[l];
+              y[i] += a * x[i];
+            }
+          },
+          [=, &list]() {
+            RAJA::forall<exec_policy>(list, [=](RAJA::Index_type i) {
+              y[i] += a * x[i];
+            });
+          });
+}
+
+static void compare_views()
+{
+  const RAJA::Index_type n = N_3D;
+  std::vector<double> av(n * n * n, 1.0), bv(n * n * n, 0.0);
+  double* a = &av[0];
+  double* b = &bv[0];
+
+  RAJA::View<double, RAJA::Layout<3>> a3(a, n, n, n);
+  RAJA::View<double, RAJA::Layout<3>> b3(b, n, n, n);
+
+  compare("View Layout<3>",
+          [=]() {
+            for (RAJA::Index_type i = 0; i < n; ++i) {
+              for (RAJA::Index_type j = 0; j < n; ++j) {
+                for (RAJA::Index_type k = 0; k < n; ++k) {
+                  b[(i * n + j) * n + k] = 2.0 * a[(i * n + j) * n + k];
+                }
+              }
+            }
+          },
+          [=]() {
+            for (RAJA::Index_type i = 0; i < n; ++i) {
+              for (RAJA::Index_type j = 0; j < n; ++j) {
+                for (RAJA::Index_type k = 0; k < n; ++k) {
+                  b3(i, j, k) = 2.0 * a3(i, j, k);
+                }
+              }
+            }
+          });
+
+  // i has stride 1 and k the longest stride
+  RAJA::View<double, RAJA::Layout<3>> ap(
+      a,
+      RAJA::make_permuted_layout({{n, n, n}},
+                                 RAJA::as_array<RAJA::PERM_KJI>::get()));
+  RAJA::View<double, RAJA::Layout<3>> bp(
+      b,
+      RAJA::make_permuted_layout({{n, n, n}},
+                                 RAJA::as_array<RAJA::PERM_KJI>::get()));
+
+  compare("View permuted Layout<3>",
+          [=]() {
+            for (RAJA::Index_type k = 0; k < n; ++k) {
+              for (RAJA::Index_type j = 0; j < n; ++j) {
+                for (RAJA::Index_type i = 0; i < n; ++i) {
+                  b[i + n * (j + n * k)] = 2.0 * a[i + n * (j + n * k)];
+                }
+              }
+            }
+          },
+          [=]() {
+            for (RAJA::Index_type k = 0; k < n; ++k) {
+              for (RAJA::Index_type j = 0; j < n; ++j) {
+                for (RAJA::Index_type i = 0; i < n; ++i) {
+                  bp(i, j, k) = 2.0 * ap(i, j, k);
+                }
+              }
+            }
+          });
+
+  // an n x n grid with a halo of one point, indexed from -1 to n
+  const RAJA::Index_type m = N_2D;
+  const RAJA::Index_type stride = m + 2;
+  std::vector<double> uv(stride * stride, 1.0), wv(stride * stride, 0.0);
+  double* u = &uv[0];
+  double* w = &wv[0];
+
+  RAJA::View<double, RAJA::OffsetLayout<2>> u2(
+      u, RAJA::make_offset_layout<2>({{-1, -1}}, {{m, m}}));
+  RAJA::View<double, RAJA::OffsetLayout<2>> w2(
+      w, RAJA::make_offset_layout<2>({{-1, -1}}, {{m, m}}));
+
+  compare("View OffsetLayout<2>",
+          [=]() {
+            for (RAJA::Index_type i = 0; i < m; ++i) {
+              for (RAJA::Index_type j = 0; j < m; ++j) {
+                const RAJA::Index_type c = (i + 1) * stride + (j + 1);
+                w[c] = 0.25 * (u[c - stride] + u[c + stride] + u[c - 1] +
+                               u[c + 1]);
+              }
+            }
+          },
+          [=]() {
+            for (RAJA::Index_type i = 0; i < m; ++i) {
+              for (RAJA::Index_type j = 0; j < m; ++j) {
+                w2(i, j) = 0.25 * (u2(i - 1, j) + u2(i + 1, j) +
+                                   u2(i, j - 1) + u2(i, j + 1));
+              }
+            }
+          });
+}
+
+static void compare_kernels()
+{
+  using namespace RAJA::statement;
+
+  std::vector<double> av(N_1D, 1.0), bv(N_1D, 0.0);
+  double* a = &av[0];
+  double* b = &bv[0];
+
+  {
+    const RAJA::Index_type n = N_2D;
+    using policy = RAJA::KernelPolicy<
+        For<0, exec_policy,
+          For<1, exec_policy,
+            Lambda<0>
+          >
+        >
+      >;
+
+    compare("kernel 2 nested For",
+            [=]() {
+              for (RAJA::Index_type i = 0; i < n; ++i) {
+                for (RAJA::Index_type j = 0; j < n; ++j) {
+                  b[i * n + j] += 2.0 * a[i * n + j];
+                }
+              }
+            },
+            [=]() {
+              RAJA::kernel<policy>(
+                  RAJA::make_tuple(RAJA::RangeSegment(0, n),
+                                   RAJA::RangeSegment(0, n)),
+                  [=](RAJA::Index_type i, RAJA::Index_type j) {
+                    b[i * n + j] += 2.0 * a[i * n + j];
+                  });
+            });
+  }
+
+  {
+    const RAJA::Index_type n = N_3D;
+    using policy = RAJA::KernelPolicy<
+        For<0, exec_policy,
+          For<1, exec_policy,
+            For<2, exec_policy,
+              Lambda<0>
+            >
+          >
+        >
+      >;
+
+    compare("kernel 3 nested For",
+            [=]() {
+              for (RAJA::Index_type i = 0; i < n; ++i) {
+                for (RAJA::Index_type j = 0; j < n; ++j) {
+                  for (RAJA::Index_type k = 0; k < n; ++k) {
+                    b[(i * n + j) * n + k] += 2.0 * a[(i * n + j) * n + k];
+                  }
+                }
+              }
+            },
+            [=]() {
+              RAJA::kernel<policy>(
+                  RAJA::make_tuple(RAJA::RangeSegment(0, n),
+                                   RAJA::RangeSegment(0, n),
+                                   RAJA::RangeSegment(0, n)),
+                  [=](RAJA::Index_type i,
+                      RAJA::Index_type j,
+                      RAJA::Index_type k) {
+                    b[(i * n + j) * n + k] += 2.0 * a[(i * n + j) * n + k];
+                  });
+            });
+  }
+
+  {
+    const RAJA::Index_type n = N_4D;
+    using policy = RAJA::KernelPolicy<
+        For<0, exec_policy,
+          For<1, exec_policy,
+            For<2, exec_policy,
+              For<3, exec_policy,
+                Lambda<0>
+              >
+            >
+          >
+        >
+      >;
+
+    compare("kernel 4 nested For",
+            [=]() {
+              for (RAJA::Index_type i = 0; i < n; ++i) {
+                for (RAJA::Index_type j = 0; j < n; ++j) {
+                  for (RAJA::Index_type k = 0; k < n; ++k) {
+                    for (RAJA::Index_type l = 0; l < n; ++l) {
+                      const RAJA::Index_type c = ((i * n + j) * n + k) * n + l;
+                      b[c] += 2.0 * a[c];
+                    }
+                  }
+                }
+              }
+            },
+            [=]() {
+              RAJA::kernel<policy>(
+                  RAJA::make_tuple(RAJA::RangeSegment(0, n),
+                                   RAJA::RangeSegment(0, n),
+                                   RAJA::RangeSegment(0, n),
+                                   RAJA::RangeSegment(0, n)),
+                  [=](RAJA::Index_type i,
+                      RAJA::Index_type j,
+                      RAJA::Index_type k,
+                      RAJA::Index_type l) {
+                    const RAJA::Index_type c = ((i * n + j) * n + k) * n + l;
+                    b[c] += 2.0 * a[c];
+                  });
+            });
+  }
+}
+
+static void compare_reducers()
+{
+  const RAJA::Index_type n = N_1D;
+  std::vector<double> xv(n);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    xv[i] = double((i * 7919) % n);
+  }
+  const double* x = &xv[0];
+
+  // results are kept so the loops are not optimized away
+  static volatile double sink;
+
+  compare("ReduceSum",
+          [=]() {
+            double sum = 0.0;
+            for (RAJA::Index_type i = 0; i < n; ++i) {
+              sum += x[i];
+            }
+            sink = sum;
+          },
+          [=]() {
+            RAJA::ReduceSum<reduce_policy, double> sum(0.0);
+            RAJA::forall<exec_policy>(RAJA::RangeSegment(0, n),
+                                      [=](RAJA::Index_type i) {
+                                        sum += x[i];
+                                      });
+            sink = sum.get();
+          });
+
+  compare("ReduceMin",
+          [=]() {
+            double min = x[0];
+            for (RAJA::Index_type i = 0; i < n; ++i) {
+              min = x[i] < min ? x[i] : min;
+            }
+            sink = min;
+          },
+          [=]() {
+            RAJA::ReduceMin<reduce_policy, double> min(x[0]);
+            RAJA::forall<exec_policy>(RAJA::RangeSegment(0, n),
+                                      [=](RAJA::Index_type i) {
+                                        min.min(x[i]);
+                                      });
+            sink = min.get();
+          });
+
+  compare("ReduceMaxLoc",
+          [=]() {
+            double max = x[0];
+            RAJA::Index_type loc = 0;
+            for (RAJA::Index_type i = 0; i < n; ++i) {
+              if (x[i] > max) {
+                max = x[i];
+                loc = i;
+              }
+            }
+            sink = max + loc;
+          },
+          [=]() {
+            RAJA::ReduceMaxLoc<reduce_policy, double> max(x[0], 0);
+            RAJA::forall<exec_policy>(RAJA::RangeSegment(0, n),
+                                      [=](RAJA::Index_type i) {
+                                        max.maxloc(x[i], i);
+                                      });
+            sink = max.get() + max.getLoc();
+          });
+}
+
+int main(int argc, char** argv)
+{
+  double threshold = 1.25;
+  for (int a = 1; a < argc; ++a) {
+    if (strncmp(argv[a], "--threshold=", 12) == 0) {
+      threshold = atof(argv[a] + 12);
+    } else if (strncmp(argv[a], "--repeats=", 10) == 0) {
+      repeats = std::max(1, atoi(argv[a] + 10));
+    } else {
+      printf("Usage: %s [--threshold=<ratio>] [--repeats=<count>]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  compare_forall();
+  compare_views();
+  compare_kernels();
+  compare_reducers();
+
+  int failures = 0;
+  printf("%-28s %12s %12s %8s\n", "construct", "raw (ms)", "RAJA (ms)", "ratio");
+  for (auto const& c : comparisons) {
+    const bool failed = c.ratio() > threshold;
+    failures += failed ? 1 : 0;
+    printf("%-28s %12.4f %12.4f %8.3f%s\n",
+           c.name.c_str(),
+           c.raw_time * 1.0e3,
+           c.raja_time * 1.0e3,
+           c.ratio(),
+           failed ? "  FAILED" : "");
+  }
+
+  if (failures) {
+    printf("%d of %zu RAJA loops are more than %.2fx slower than raw loops\n",
+           failures,
+           comparisons.size(),
+           threshold);
+    return 1;
+  }
+  printf("All RAJA loops are within %.2fx of raw loops\n", threshold);
+  return 0;
+}
@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// A histogram of RAJA::atomicAdd updates into a varying number of bins,
+// from every update hitting one bin to updates spread over many cache
+// lines, for each host execution policy with its atomic policies.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+#define UPDATES (1 << 22)
+
+template <typename ExecPolicy_, typename AtomicPolicy_, typename T_>
+struct AtomicPolicies {
+  using ExecPolicy = ExecPolicy_;
+  using AtomicPolicy = AtomicPolicy_;
+  using T = T_;
+};
+
+template <typename Policies>
+static void benchmark_atomic_histogram(benchmark::State& state)
+{
+  using T = typename Policies::T;
+
+  const RAJA::Index_type num_bins = state.range(0);
+  std::vector<T> bins(num_bins, T(0));
+  T* counts = &bins[0];
+
+  while (state.KeepRunning()) {
+    RAJA::forall<typename Policies::ExecPolicy>(
+        RAJA::RangeSegment(0, UPDATES), [=](RAJA::Index_type i) {
+          // scatter neighboring iterates over the bins
+          RAJA::atomicAdd<typename Policies::AtomicPolicy>(
+              &counts[(i * 7919) % num_bins], T(1));
+        });
+    benchmark::DoNotOptimize(bins[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * UPDATES);
+}
+
+#define ATOMIC_BENCHMARKS(Policies)                                     \
+  BENCHMARK_TEMPLATE(benchmark_atomic_histogram, Policies)              \
+      ->Arg(1)->Arg(64)->Arg(4096)->Arg(1 << 20)->UseRealTime()
+
+using seq_atomic_int = AtomicPolicies<RAJA::seq_exec, RAJA::seq_atomic, int>;
+using loop_atomic_int = AtomicPolicies<RAJA::loop_exec, RAJA::seq_atomic, int>;
+using simd_atomic_int = AtomicPolicies<RAJA::simd_exec, RAJA::seq_atomic, int>;
+
+ATOMIC_BENCHMARKS(seq_atomic_int);
+ATOMIC_BENCHMARKS(loop_atomic_int);
+ATOMIC_BENCHMARKS(simd_atomic_int);
+
+#if defined(RAJA_ENABLE_OPENMP)
+using omp_atomic_int =
+    AtomicPolicies<RAJA::omp_parallel_for_exec, RAJA::omp_atomic, int>;
+using omp_atomic_double =
+    AtomicPolicies<RAJA::omp_parallel_for_exec, RAJA::omp_atomic, double>;
+using omp_builtin_atomic_int =
+    AtomicPolicies<RAJA::omp_parallel_for_exec, RAJA::builtin_atomic, int>;
+using omp_builtin_atomic_double =
+    AtomicPolicies<RAJA::omp_parallel_for_exec, RAJA::builtin_atomic, double>;
+using omp_auto_atomic_int =
+    AtomicPolicies<RAJA::omp_parallel_for_exec, RAJA::auto_atomic, int>;
+
+ATOMIC_BENCHMARKS(omp_atomic_int);
+ATOMIC_BENCHMARKS(omp_atomic_double);
+ATOMIC_BENCHMARKS(omp_builtin_atomic_int);
+ATOMIC_BENCHMARKS(omp_builtin_atomic_double);
+ATOMIC_BENCHMARKS(omp_auto_atomic_int);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+using tbb_builtin_atomic_int =
+    AtomicPolicies<RAJA::tbb_for_exec, RAJA::builtin_atomic, int>;
+using tbb_builtin_atomic_double =
+    AtomicPolicies<RAJA::tbb_for_exec, RAJA::builtin_atomic, double>;
+using tbb_auto_atomic_int =
+    AtomicPolicies<RAJA::tbb_for_exec, RAJA::auto_atomic, int>;
+
+ATOMIC_BENCHMARKS(tbb_builtin_atomic_int);
+ATOMIC_BENCHMARKS(tbb_builtin_atomic_double);
+ATOMIC_BENCHMARKS(tbb_auto_atomic_int);
+#endif
+
+BENCHMARK_MAIN();
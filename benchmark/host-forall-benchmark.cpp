@@ -0,0 +1,203 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// STREAM copy, scale, add and triad written as RAJA::forall loops, and a
+// traversal of an IndexSet mixing range, strided range and list segments,
+// for each host execution policy.  Each loop runs over arrays that fit in
+// the last level cache and over arrays that do not.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include <memory>
+#include <vector>
+
+#define SMALL (1 << 16)
+#define LARGE (1 << 24)
+
+struct StreamData {
+  std::unique_ptr<double[]> a, b, c;
+
+  template <typename ExecPolicy>
+  StreamData(ExecPolicy, RAJA::Index_type n)
+      : a(new double[n]), b(new double[n]), c(new double[n])
+  {
+    // first touch with the threads of the benchmark
+    double *pa = a.get(), *pb = b.get(), *pc = c.get();
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+      pa[i] = 1.0;
+      pb[i] = 2.0;
+      pc[i] = 0.0;
+    });
+  }
+};
+
+template <typename ExecPolicy>
+static void benchmark_stream_copy(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  StreamData data(ExecPolicy{}, n);
+  double *a = &data.a[0], *c = &data.c[0];
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](RAJA::Index_type i) { c[i] = a[i]; });
+    benchmark::DoNotOptimize(c[0]);
+  }
+  state.SetBytesProcessed(state.iterations() * n * 2 * sizeof(double));
+}
+
+template <typename ExecPolicy>
+static void benchmark_stream_scale(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  StreamData data(ExecPolicy{}, n);
+  double *b = &data.b[0], *c = &data.c[0];
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](RAJA::Index_type i) { b[i] = 3.0 * c[i]; });
+    benchmark::DoNotOptimize(b[0]);
+  }
+  state.SetBytesProcessed(state.iterations() * n * 2 * sizeof(double));
+}
+
+template <typename ExecPolicy>
+static void benchmark_stream_add(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  StreamData data(ExecPolicy{}, n);
+  double *a = &data.a[0], *b = &data.b[0], *c = &data.c[0];
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n),
+                             [=](RAJA::Index_type i) { c[i] = a[i] + b[i]; });
+    benchmark::DoNotOptimize(c[0]);
+  }
+  state.SetBytesProcessed(state.iterations() * n * 3 * sizeof(double));
+}
+
+template <typename ExecPolicy>
+static void benchmark_stream_triad(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  StreamData data(ExecPolicy{}, n);
+  double *a = &data.a[0], *b = &data.b[0], *c = &data.c[0];
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+      a[i] = b[i] + 3.0 * c[i];
+    });
+    benchmark::DoNotOptimize(a[0]);
+  }
+  state.SetBytesProcessed(state.iterations() * n * 3 * sizeof(double));
+}
+
+//
+// An IndexSet covering [0, n) with a range, a strided range of the even
+// indices of the next block, a list of its odd indices, and a final range.
+//
+struct IndexSetData {
+  using IndexSet_type = RAJA::TypedIndexSet<RAJA::RangeSegment,
+                                            RAJA::RangeStrideSegment,
+                                            RAJA::ListSegment>;
+
+  std::unique_ptr<double[]> x, y;
+  std::vector<RAJA::Index_type> odd;
+  camp::resources::Resource host_res;
+  IndexSet_type iset;
+
+  template <typename ExecPolicy>
+  IndexSetData(ExecPolicy, RAJA::Index_type n)
+      : x(new double[n]), y(new double[n]), host_res(camp::resources::Host())
+  {
+    const RAJA::Index_type quarter = n / 4;
+    for (RAJA::Index_type i = quarter + 1; i < 3 * quarter; i += 2) {
+      odd.push_back(i);
+    }
+    iset.push_back(RAJA::RangeSegment(0, quarter));
+    iset.push_back(RAJA::RangeStrideSegment(quarter, 3 * quarter, 2));
+    iset.push_back(RAJA::ListSegment(&odd[0], odd.size(), host_res));
+    iset.push_back(RAJA::RangeSegment(3 * quarter, n));
+
+    // first touch with the threads that traverse each segment
+    double *px = x.get(), *py = y.get();
+    RAJA::forall<ExecPolicy>(iset, [=](RAJA::Index_type i) {
+      px[i] = 1.0;
+      py[i] = 0.0;
+    });
+  }
+};
+
+template <typename ExecPolicy>
+static void benchmark_indexset_mixed(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  IndexSetData data(ExecPolicy{}, n);
+  double *x = &data.x[0], *y = &data.y[0];
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPolicy>(data.iset, [=](RAJA::Index_type i) {
+      y[i] += 0.5 * x[i];
+    });
+    benchmark::DoNotOptimize(y[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+#define STREAM_BENCHMARKS(ExecPolicy)                                   \
+  BENCHMARK_TEMPLATE(benchmark_stream_copy, ExecPolicy)                 \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_stream_scale, ExecPolicy)                \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_stream_add, ExecPolicy)                  \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_stream_triad, ExecPolicy)                \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime()
+
+#define INDEXSET_BENCHMARKS(ISetPolicy)                                 \
+  BENCHMARK_TEMPLATE(benchmark_indexset_mixed, ISetPolicy)              \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime()
+
+using seq_iset = RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>;
+using loop_iset = RAJA::ExecPolicy<RAJA::seq_segit, RAJA::loop_exec>;
+using simd_iset = RAJA::ExecPolicy<RAJA::seq_segit, RAJA::simd_exec>;
+
+STREAM_BENCHMARKS(RAJA::seq_exec);
+STREAM_BENCHMARKS(RAJA::loop_exec);
+STREAM_BENCHMARKS(RAJA::simd_exec);
+INDEXSET_BENCHMARKS(seq_iset);
+INDEXSET_BENCHMARKS(loop_iset);
+INDEXSET_BENCHMARKS(simd_iset);
+
+#if defined(RAJA_ENABLE_OPENMP)
+using omp_static = RAJA::omp_parallel_for_static<>;
+// segments in parallel, or each segment in parallel
+using omp_segit_iset = RAJA::ExecPolicy<RAJA::omp_parallel_for_segit,
+                                        RAJA::loop_exec>;
+using omp_inner_iset = RAJA::ExecPolicy<RAJA::seq_segit,
+                                        RAJA::omp_parallel_for_exec>;
+
+STREAM_BENCHMARKS(RAJA::omp_parallel_for_exec);
+STREAM_BENCHMARKS(omp_static);
+INDEXSET_BENCHMARKS(omp_segit_iset);
+INDEXSET_BENCHMARKS(omp_inner_iset);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+using tbb_segit_iset = RAJA::ExecPolicy<RAJA::tbb_segit, RAJA::loop_exec>;
+using tbb_inner_iset = RAJA::ExecPolicy<RAJA::seq_segit, RAJA::tbb_for_exec>;
+
+STREAM_BENCHMARKS(RAJA::tbb_for_exec);
+STREAM_BENCHMARKS(RAJA::tbb_for_dynamic);
+INDEXSET_BENCHMARKS(tbb_segit_iset);
+INDEXSET_BENCHMARKS(tbb_inner_iset);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,190 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// RAJA::kernel loop nests over an n x n grid for each host execution
+// policy: a 5-point Jacobi sweep as nested For statements, as a Collapse
+// and with fixed tiles, and an in-place Gauss-Seidel sweep as a Hyperplane
+// (wavefront) whose points are independent within each hyperplane.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include <memory>
+
+#define SMALL 256
+#define LARGE 2048
+
+#define TILE 64
+
+//
+// Outer is the policy of the outermost loop, which is parallel for the
+// parallel backends, Serial the policy of the loops between it and the
+// innermost loop, and Inner the policy of the innermost, contiguous loop.
+//
+template <typename Outer_, typename Serial_, typename Inner_>
+struct KernelPolicies {
+  using Outer = Outer_;
+  using Serial = Serial_;
+  using Inner = Inner_;
+};
+
+using view_2d = RAJA::View<double, RAJA::Layout<2>>;
+
+struct GridData {
+  std::unique_ptr<double[]> a, b;
+
+  template <typename RowPolicy>
+  GridData(RowPolicy, RAJA::Index_type n)
+      : a(new double[n * n]), b(new double[n * n])
+  {
+    // first touch of each row with the thread of the outer loop
+    double *pa = a.get(), *pb = b.get();
+    RAJA::forall<RowPolicy>(RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+      for (RAJA::Index_type j = 0; j < n; ++j) {
+        pa[i * n + j] = double((i * n + j) % 17);
+        pb[i * n + j] = 0.0;
+      }
+    });
+  }
+};
+
+template <typename KernelPolicy, typename RowPolicy>
+static void run_jacobi(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  GridData data(RowPolicy{}, n);
+  view_2d a(&data.a[0], n, n);
+  view_2d b(&data.b[0], n, n);
+
+  auto interior = RAJA::make_tuple(RAJA::RangeSegment(1, n - 1),
+                                   RAJA::RangeSegment(1, n - 1));
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<KernelPolicy>(
+        interior, [=](RAJA::Index_type i, RAJA::Index_type j) {
+          b(i, j) =
+              0.25 * (a(i - 1, j) + a(i + 1, j) + a(i, j - 1) + a(i, j + 1));
+        });
+    benchmark::DoNotOptimize(data.b[n + 1]);
+  }
+  state.SetItemsProcessed(state.iterations() * (n - 2) * (n - 2));
+}
+
+template <typename Policies>
+static void benchmark_kernel_nest(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using KernelPolicy = RAJA::KernelPolicy<
+      For<0, typename Policies::Outer,
+        For<1, typename Policies::Inner,
+          Lambda<0>
+        >
+      >
+    >;
+
+  run_jacobi<KernelPolicy, typename Policies::Outer>(state);
+}
+
+template <typename Policies>
+static void benchmark_kernel_tile(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using KernelPolicy = RAJA::KernelPolicy<
+      Tile<0, RAJA::tile_fixed<TILE>, typename Policies::Outer,
+        Tile<1, RAJA::tile_fixed<TILE>, typename Policies::Serial,
+          For<0, typename Policies::Serial,
+            For<1, typename Policies::Inner,
+              Lambda<0>
+            >
+          >
+        >
+      >
+    >;
+
+  run_jacobi<KernelPolicy, typename Policies::Outer>(state);
+}
+
+template <typename Policies>
+static void benchmark_kernel_hyperplane(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  // hyperplanes i + j = h in order, the points of each with Outer
+  using KernelPolicy = RAJA::KernelPolicy<
+      Hyperplane<0, typename Policies::Serial, RAJA::ArgList<1>,
+                 typename Policies::Outer,
+        Lambda<0>
+      >
+    >;
+
+  const RAJA::Index_type n = state.range(0);
+  GridData data(typename Policies::Outer{}, n);
+  view_2d a(&data.a[0], n, n);
+
+  auto interior = RAJA::make_tuple(RAJA::RangeSegment(1, n - 1),
+                                   RAJA::RangeSegment(1, n - 1));
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<KernelPolicy>(
+        interior, [=](RAJA::Index_type i, RAJA::Index_type j) {
+          a(i, j) =
+              0.25 * (a(i - 1, j) + a(i + 1, j) + a(i, j - 1) + a(i, j + 1));
+        });
+    benchmark::DoNotOptimize(data.a[n + 1]);
+  }
+  state.SetItemsProcessed(state.iterations() * (n - 2) * (n - 2));
+}
+
+#define KERNEL_BENCHMARKS(Policies)                                     \
+  BENCHMARK_TEMPLATE(benchmark_kernel_nest, Policies)                   \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_kernel_tile, Policies)                   \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_kernel_hyperplane, Policies)             \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime()
+
+using seq_kernel =
+    KernelPolicies<RAJA::seq_exec, RAJA::seq_exec, RAJA::seq_exec>;
+using loop_kernel =
+    KernelPolicies<RAJA::loop_exec, RAJA::loop_exec, RAJA::loop_exec>;
+using simd_kernel =
+    KernelPolicies<RAJA::loop_exec, RAJA::loop_exec, RAJA::simd_exec>;
+
+KERNEL_BENCHMARKS(seq_kernel);
+KERNEL_BENCHMARKS(loop_kernel);
+KERNEL_BENCHMARKS(simd_kernel);
+
+#if defined(RAJA_ENABLE_OPENMP)
+static void benchmark_kernel_collapse(benchmark::State& state)
+{
+  using namespace RAJA::statement;
+  using KernelPolicy = RAJA::KernelPolicy<
+      Collapse<RAJA::omp_parallel_collapse_exec, RAJA::ArgList<0, 1>,
+        Lambda<0>
+      >
+    >;
+
+  run_jacobi<KernelPolicy, RAJA::omp_parallel_for_exec>(state);
+}
+
+using omp_kernel = KernelPolicies<RAJA::omp_parallel_for_exec,
+                                  RAJA::loop_exec,
+                                  RAJA::loop_exec>;
+
+KERNEL_BENCHMARKS(omp_kernel);
+BENCHMARK(benchmark_kernel_collapse)->Arg(SMALL)->Arg(LARGE)->UseRealTime();
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+using tbb_kernel =
+    KernelPolicies<RAJA::tbb_for_exec, RAJA::loop_exec, RAJA::loop_exec>;
+
+KERNEL_BENCHMARKS(tbb_kernel);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,204 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Each RAJA reducer type over an array, for each host execution policy
+// with its reduction policy.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include <memory>
+
+#define SMALL (1 << 16)
+#define LARGE (1 << 24)
+
+template <typename ExecPolicy_, typename ReducePolicy_>
+struct ReducePolicies {
+  using ExecPolicy = ExecPolicy_;
+  using ReducePolicy = ReducePolicy_;
+};
+
+struct ReduceData {
+  std::unique_ptr<double[]> x;
+  std::unique_ptr<int[]> bits;
+
+  template <typename ExecPolicy>
+  ReduceData(ExecPolicy, RAJA::Index_type n)
+      : x(new double[n]), bits(new int[n])
+  {
+    // first touch with the threads of the benchmark
+    double* px = x.get();
+    int* pbits = bits.get();
+    RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) {
+      px[i] = double((i * 7919) % n) - 0.5 * n;
+      pbits[i] = ~(1 << (i % 31));
+    });
+  }
+};
+
+template <typename Policies>
+static void benchmark_reduce_sum(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  ReduceData data(typename Policies::ExecPolicy{}, n);
+  const double* x = &data.x[0];
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<typename Policies::ReducePolicy, double> sum(0.0);
+    RAJA::forall<typename Policies::ExecPolicy>(
+        RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) { sum += x[i]; });
+    benchmark::DoNotOptimize(sum.get());
+  }
+  state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+
+template <typename Policies>
+static void benchmark_reduce_min(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  ReduceData data(typename Policies::ExecPolicy{}, n);
+  const double* x = &data.x[0];
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceMin<typename Policies::ReducePolicy, double> min(x[0]);
+    RAJA::forall<typename Policies::ExecPolicy>(
+        RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) { min.min(x[i]); });
+    benchmark::DoNotOptimize(min.get());
+  }
+  state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+
+template <typename Policies>
+static void benchmark_reduce_max(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  ReduceData data(typename Policies::ExecPolicy{}, n);
+  const double* x = &data.x[0];
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceMax<typename Policies::ReducePolicy, double> max(x[0]);
+    RAJA::forall<typename Policies::ExecPolicy>(
+        RAJA::RangeSegment(0, n), [=](RAJA::Index_type i) { max.max(x[i]); });
+    benchmark::DoNotOptimize(max.get());
+  }
+  state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+
+template <typename Policies>
+static void benchmark_reduce_minloc(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  ReduceData data(typename Policies::ExecPolicy{}, n);
+  const double* x = &data.x[0];
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceMinLoc<typename Policies::ReducePolicy, double> minloc(x[0],
+                                                                       0);
+    RAJA::forall<typename Policies::ExecPolicy>(
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::Index_type i) { minloc.minloc(x[i], i); });
+    benchmark::DoNotOptimize(minloc.getLoc());
+  }
+  state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+
+template <typename Policies>
+static void benchmark_reduce_maxloc(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  ReduceData data(typename Policies::ExecPolicy{}, n);
+  const double* x = &data.x[0];
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceMaxLoc<typename Policies::ReducePolicy, double> maxloc(x[0],
+                                                                       0);
+    RAJA::forall<typename Policies::ExecPolicy>(
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::Index_type i) { maxloc.maxloc(x[i], i); });
+    benchmark::DoNotOptimize(maxloc.getLoc());
+  }
+  state.SetBytesProcessed(state.iterations() * n * sizeof(double));
+}
+
+template <typename Policies>
+static void benchmark_reduce_bitor(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  ReduceData data(typename Policies::ExecPolicy{}, n);
+  const int* bits = &data.bits[0];
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceBitOr<typename Policies::ReducePolicy, int> bit_or(0);
+    RAJA::forall<typename Policies::ExecPolicy>(
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::Index_type i) { bit_or |= ~bits[i]; });
+    benchmark::DoNotOptimize(bit_or.get());
+  }
+  state.SetBytesProcessed(state.iterations() * n * sizeof(int));
+}
+
+template <typename Policies>
+static void benchmark_reduce_bitand(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  ReduceData data(typename Policies::ExecPolicy{}, n);
+  const int* bits = &data.bits[0];
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceBitAnd<typename Policies::ReducePolicy, int> bit_and(~0);
+    RAJA::forall<typename Policies::ExecPolicy>(
+        RAJA::RangeSegment(0, n),
+        [=](RAJA::Index_type i) { bit_and &= bits[i]; });
+    benchmark::DoNotOptimize(bit_and.get());
+  }
+  state.SetBytesProcessed(state.iterations() * n * sizeof(int));
+}
+
+#define REDUCE_BENCHMARKS(Policies)                                     \
+  BENCHMARK_TEMPLATE(benchmark_reduce_sum, Policies)                    \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_reduce_min, Policies)                    \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_reduce_max, Policies)                    \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_reduce_minloc, Policies)                 \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_reduce_maxloc, Policies)                 \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_reduce_bitor, Policies)                  \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_reduce_bitand, Policies)                 \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime()
+
+using seq_reducers = ReducePolicies<RAJA::seq_exec, RAJA::seq_reduce>;
+using loop_reducers = ReducePolicies<RAJA::loop_exec, RAJA::seq_reduce>;
+using simd_reducers =
+    ReducePolicies<RAJA::simd_reduce_exec, RAJA::simd_reduce>;
+
+REDUCE_BENCHMARKS(seq_reducers);
+REDUCE_BENCHMARKS(loop_reducers);
+REDUCE_BENCHMARKS(simd_reducers);
+
+#if defined(RAJA_ENABLE_OPENMP)
+using omp_reducers =
+    ReducePolicies<RAJA::omp_parallel_for_exec, RAJA::omp_reduce>;
+using omp_ordered_reducers =
+    ReducePolicies<RAJA::omp_parallel_for_exec, RAJA::omp_reduce_ordered>;
+
+REDUCE_BENCHMARKS(omp_reducers);
+REDUCE_BENCHMARKS(omp_ordered_reducers);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+using tbb_reducers = ReducePolicies<RAJA::tbb_for_exec, RAJA::tbb_reduce>;
+
+REDUCE_BENCHMARKS(tbb_reducers);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,178 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// RAJA scans (inclusive, exclusive, in place) and sorts (sort,
+// stable_sort, sort_pairs, stable_sort_pairs) for each host execution
+// policy that implements them.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#define SMALL (1 << 16)
+#define LARGE (1 << 22)
+
+static std::vector<int> random_values(RAJA::Index_type n)
+{
+  std::vector<int> values(n);
+  std::mt19937 gen(12345);
+  std::uniform_int_distribution<int> dist(0, 1 << 20);
+  for (auto& v : values) {
+    v = dist(gen);
+  }
+  return values;
+}
+
+template <typename ExecPolicy>
+static void benchmark_inclusive_scan(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  std::vector<int> in = random_values(n);
+  std::vector<int> out(n);
+
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan<ExecPolicy>(&in[0], &in[0] + n, &out[0]);
+    benchmark::DoNotOptimize(out[n - 1]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename ExecPolicy>
+static void benchmark_exclusive_scan(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  std::vector<int> in = random_values(n);
+  std::vector<int> out(n);
+
+  while (state.KeepRunning()) {
+    RAJA::exclusive_scan<ExecPolicy>(&in[0], &in[0] + n, &out[0]);
+    benchmark::DoNotOptimize(out[n - 1]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename ExecPolicy>
+static void benchmark_inclusive_scan_inplace(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  // max keeps the values bounded when the scan is repeated in place
+  std::vector<int> data = random_values(n);
+
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan_inplace<ExecPolicy>(&data[0],
+                                             &data[0] + n,
+                                             RAJA::operators::maximum<int>{});
+    benchmark::DoNotOptimize(data[n - 1]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename ExecPolicy>
+static void benchmark_sort(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const std::vector<int> values = random_values(n);
+  std::vector<int> keys(n);
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    std::copy(values.begin(), values.end(), keys.begin());
+    state.ResumeTiming();
+    RAJA::sort<ExecPolicy>(&keys[0], &keys[0] + n);
+    benchmark::DoNotOptimize(keys[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename ExecPolicy>
+static void benchmark_stable_sort(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const std::vector<int> values = random_values(n);
+  std::vector<int> keys(n);
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    std::copy(values.begin(), values.end(), keys.begin());
+    state.ResumeTiming();
+    RAJA::stable_sort<ExecPolicy>(&keys[0], &keys[0] + n);
+    benchmark::DoNotOptimize(keys[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename ExecPolicy>
+static void benchmark_sort_pairs(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const std::vector<int> values = random_values(n);
+  std::vector<int> keys(n);
+  std::vector<double> vals(n);
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    std::copy(values.begin(), values.end(), keys.begin());
+    std::copy(values.begin(), values.end(), vals.begin());
+    state.ResumeTiming();
+    RAJA::sort_pairs<ExecPolicy>(&keys[0], &keys[0] + n, &vals[0]);
+    benchmark::DoNotOptimize(vals[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename ExecPolicy>
+static void benchmark_stable_sort_pairs(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  const std::vector<int> values = random_values(n);
+  std::vector<int> keys(n);
+  std::vector<double> vals(n);
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    std::copy(values.begin(), values.end(), keys.begin());
+    std::copy(values.begin(), values.end(), vals.begin());
+    state.ResumeTiming();
+    RAJA::stable_sort_pairs<ExecPolicy>(&keys[0], &keys[0] + n, &vals[0]);
+    benchmark::DoNotOptimize(vals[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+#define SCAN_SORT_BENCHMARKS(ExecPolicy)                                \
+  BENCHMARK_TEMPLATE(benchmark_inclusive_scan, ExecPolicy)              \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_exclusive_scan, ExecPolicy)              \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_inclusive_scan_inplace, ExecPolicy)      \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_sort, ExecPolicy)                        \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_stable_sort, ExecPolicy)                 \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_sort_pairs, ExecPolicy)                  \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime();                          \
+  BENCHMARK_TEMPLATE(benchmark_stable_sort_pairs, ExecPolicy)           \
+      ->Arg(SMALL)->Arg(LARGE)->UseRealTime()
+
+SCAN_SORT_BENCHMARKS(RAJA::seq_exec);
+SCAN_SORT_BENCHMARKS(RAJA::loop_exec);
+
+#if defined(RAJA_ENABLE_OPENMP)
+SCAN_SORT_BENCHMARKS(RAJA::omp_parallel_for_exec);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+SCAN_SORT_BENCHMARKS(RAJA::tbb_for_exec);
+#endif
+
+BENCHMARK_MAIN();
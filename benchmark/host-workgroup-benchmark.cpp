@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Many short gather loops, as in a halo exchange packing buffers, run
+// through a WorkPool, WorkGroup and WorkSite for each host WorkGroup
+// policy, and as one forall per loop for comparison.  The number of loops
+// varies while the total number of iterates stays the same.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include <memory>
+#include <vector>
+
+#define TOTAL (1 << 20)
+
+struct PackData {
+  std::vector<double> var, buffer;
+  std::vector<RAJA::Index_type> list;
+
+  PackData() : var(2 * TOTAL, 1.0), buffer(TOTAL, 0.0), list(TOTAL)
+  {
+    // every other element, as for a face of a structured grid
+    for (RAJA::Index_type i = 0; i < TOTAL; ++i) {
+      list[i] = 2 * i;
+    }
+  }
+};
+
+static PackData& pack_data()
+{
+  static PackData data;
+  return data;
+}
+
+template <typename WorkPolicy, typename OrderPolicy, typename StoragePolicy>
+static void benchmark_workgroup_pack(benchmark::State& state)
+{
+  using policy = RAJA::WorkGroupPolicy<WorkPolicy, OrderPolicy, StoragePolicy>;
+  using allocator = std::allocator<char>;
+  using workpool =
+      RAJA::WorkPool<policy, RAJA::Index_type, RAJA::xargs<>, allocator>;
+  using workgroup =
+      RAJA::WorkGroup<policy, RAJA::Index_type, RAJA::xargs<>, allocator>;
+  using worksite =
+      RAJA::WorkSite<policy, RAJA::Index_type, RAJA::xargs<>, allocator>;
+
+  const RAJA::Index_type num_loops = state.range(0);
+  const RAJA::Index_type len = TOTAL / num_loops;
+  PackData& data = pack_data();
+  const double* var = &data.var[0];
+
+  workpool pool(allocator{});
+
+  while (state.KeepRunning()) {
+    for (RAJA::Index_type l = 0; l < num_loops; ++l) {
+      double* buffer = &data.buffer[l * len];
+      const RAJA::Index_type* list = &data.list[l * len];
+      pool.enqueue(RAJA::TypedRangeSegment<RAJA::Index_type>(0, len),
+                   [=](RAJA::Index_type i) { buffer[i] = var[list[i]]; });
+    }
+    workgroup group = pool.instantiate();
+    worksite site = group.run();
+    benchmark::DoNotOptimize(data.buffer[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * num_loops * len);
+}
+
+template <typename ExecPolicy>
+static void benchmark_forall_pack(benchmark::State& state)
+{
+  const RAJA::Index_type num_loops = state.range(0);
+  const RAJA::Index_type len = TOTAL / num_loops;
+  PackData& data = pack_data();
+  const double* var = &data.var[0];
+
+  while (state.KeepRunning()) {
+    for (RAJA::Index_type l = 0; l < num_loops; ++l) {
+      double* buffer = &data.buffer[l * len];
+      const RAJA::Index_type* list = &data.list[l * len];
+      RAJA::forall<ExecPolicy>(
+          RAJA::TypedRangeSegment<RAJA::Index_type>(0, len),
+          [=](RAJA::Index_type i) { buffer[i] = var[list[i]]; });
+    }
+    benchmark::DoNotOptimize(data.buffer[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * num_loops * len);
+}
+
+#define WORKGROUP_BENCHMARKS(WorkPolicy, ExecPolicy)                    \
+  BENCHMARK_TEMPLATE(benchmark_workgroup_pack,                          \
+                     WorkPolicy,                                        \
+                     RAJA::ordered,                                     \
+                     RAJA::ragged_array_of_objects)                     \
+      ->Arg(16)->Arg(256)->Arg(4096)->UseRealTime();                    \
+  BENCHMARK_TEMPLATE(benchmark_workgroup_pack,                          \
+                     WorkPolicy,                                        \
+                     RAJA::ordered,                                     \
+                     RAJA::array_of_pointers)                           \
+      ->Arg(16)->Arg(256)->Arg(4096)->UseRealTime();                    \
+  BENCHMARK_TEMPLATE(benchmark_forall_pack, ExecPolicy)                 \
+      ->Arg(16)->Arg(256)->Arg(4096)->UseRealTime()
+
+WORKGROUP_BENCHMARKS(RAJA::seq_work, RAJA::seq_exec);
+WORKGROUP_BENCHMARKS(RAJA::loop_work, RAJA::loop_exec);
+
+#if defined(RAJA_ENABLE_OPENMP)
+WORKGROUP_BENCHMARKS(RAJA::omp_work, RAJA::omp_parallel_for_exec);
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+WORKGROUP_BENCHMARKS(RAJA::tbb_work, RAJA::tbb_for_exec);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,149 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares the cost of Layout::toIndices, which uses precomputed
+// reciprocals, against plain integer division by the same runtime strides,
+// in a flattened forall over a 3D index space.
+//
+// The construct and copy cases measure what the reciprocals cost up front:
+// building a Layout, or copying it to another linear index type, sets up
+// two divisors per dimension.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define NI 64
+#define NJ 96
+#define NK 128
+
+#define NUM_LAYOUTS 1024
+
+static void benchmark_toindices_divide(benchmark::State& state)
+{
+  RAJA::Index_type ni = NI, nj = NJ, nk = NK;
+  // hide the sizes from the optimizer, so they behave as runtime values
+  benchmark::DoNotOptimize(ni);
+  benchmark::DoNotOptimize(nj);
+  benchmark::DoNotOptimize(nk);
+  const RAJA::Index_type sj = nk, si = nj * nk;
+
+  while (state.KeepRunning()) {
+    RAJA::Index_type sum = 0;
+    RAJA::forall<RAJA::loop_exec>(RAJA::RangeSegment(0, ni * nj * nk),
+                                  [&](RAJA::Index_type lin) {
+                                    RAJA::Index_type i = (lin / si) % ni;
+                                    RAJA::Index_type j = (lin / sj) % nj;
+                                    RAJA::Index_type k = lin % nk;
+                                    sum += i + j + k;
+                                  });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * NI * NJ * NK);
+}
+
+static void benchmark_toindices_layout(benchmark::State& state)
+{
+  RAJA::Index_type ni = NI, nj = NJ, nk = NK;
+  benchmark::DoNotOptimize(ni);
+  benchmark::DoNotOptimize(nj);
+  benchmark::DoNotOptimize(nk);
+  const RAJA::Layout<3> layout(ni, nj, nk);
+
+  while (state.KeepRunning()) {
+    RAJA::Index_type sum = 0;
+    RAJA::forall<RAJA::loop_exec>(RAJA::RangeSegment(0, layout.size()),
+                                  [&](RAJA::Index_type lin) {
+                                    RAJA::Index_type i, j, k;
+                                    layout.toIndices(lin, i, j, k);
+                                    sum += i + j + k;
+                                  });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * NI * NJ * NK);
+}
+
+static void benchmark_toindices_static_layout(benchmark::State& state)
+{
+  using layout = RAJA::StaticLayout<RAJA::PERM_IJK, NI, NJ, NK>;
+
+  while (state.KeepRunning()) {
+    RAJA::Index_type sum = 0;
+    RAJA::forall<RAJA::loop_exec>(RAJA::RangeSegment(0, layout::size()),
+                                  [&](RAJA::Index_type lin) {
+                                    RAJA::Index_type i, j, k;
+                                    layout::toIndices(lin, i, j, k);
+                                    sum += i + j + k;
+                                  });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * NI * NJ * NK);
+}
+
+static void benchmark_layout_construct_strides(benchmark::State& state)
+{
+  RAJA::Index_type ni = NI, nj = NJ, nk = NK;
+  benchmark::DoNotOptimize(ni);
+  benchmark::DoNotOptimize(nj);
+  benchmark::DoNotOptimize(nk);
+
+  while (state.KeepRunning()) {
+    for (RAJA::Index_type n = 0; n < NUM_LAYOUTS; ++n) {
+      // sizes and strides only, as a Layout without divisors would compute
+      RAJA::Index_type sizes[3] = {ni, nj, nk + n};
+      RAJA::Index_type strides[3] = {sizes[1] * sizes[2], sizes[2], 1};
+      benchmark::DoNotOptimize(sizes);
+      benchmark::DoNotOptimize(strides);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_LAYOUTS);
+}
+
+static void benchmark_layout_construct(benchmark::State& state)
+{
+  RAJA::Index_type ni = NI, nj = NJ, nk = NK;
+  benchmark::DoNotOptimize(ni);
+  benchmark::DoNotOptimize(nj);
+  benchmark::DoNotOptimize(nk);
+
+  while (state.KeepRunning()) {
+    for (RAJA::Index_type n = 0; n < NUM_LAYOUTS; ++n) {
+      RAJA::Layout<3> layout(ni, nj, nk + n);
+      benchmark::DoNotOptimize(layout);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_LAYOUTS);
+}
+
+static void benchmark_layout_copy_index_type(benchmark::State& state)
+{
+  RAJA::Index_type ni = NI, nj = NJ, nk = NK;
+  benchmark::DoNotOptimize(ni);
+  benchmark::DoNotOptimize(nj);
+  benchmark::DoNotOptimize(nk);
+  RAJA::Layout<3> layout(ni, nj, nk);
+
+  while (state.KeepRunning()) {
+    for (RAJA::Index_type n = 0; n < NUM_LAYOUTS; ++n) {
+      // keep the source opaque so every copy redoes the divisor setup
+      benchmark::DoNotOptimize(layout);
+      RAJA::Layout<3, int> copy(layout);
+      benchmark::DoNotOptimize(copy);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_LAYOUTS);
+}
+
+BENCHMARK(benchmark_toindices_divide);
+BENCHMARK(benchmark_toindices_layout);
+BENCHMARK(benchmark_toindices_static_layout);
+BENCHMARK(benchmark_layout_construct_strides);
+BENCHMARK(benchmark_layout_construct);
+BENCHMARK(benchmark_layout_copy_index_type);
+
+BENCHMARK_MAIN();
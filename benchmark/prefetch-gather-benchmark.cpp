@@ -0,0 +1,92 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares a gather y[i] += a * x[i] over a randomly ordered
+// TypedListSegment, with arrays much larger than the last level cache,
+// without prefetching and with forall_prefetch at several distances.
+//
+
+#include "benchmark/benchmark_api.h"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#define N (1 << 24)
+
+struct GatherData {
+  std::vector<RAJA::Index_type> idx;
+  std::vector<double> x, y;
+  camp::resources::Resource host_res;
+  RAJA::TypedListSegment<RAJA::Index_type> list;
+
+  GatherData()
+      : idx(N),
+        x(N, 1.0),
+        y(N, 0.0),
+        host_res(camp::resources::Host()),
+        list(make_indices(idx), N, host_res)
+  {
+  }
+
+  static RAJA::Index_type* make_indices(std::vector<RAJA::Index_type>& idx)
+  {
+    for (RAJA::Index_type i = 0; i < N; ++i) {
+      idx[i] = i;
+    }
+    std::shuffle(idx.begin(), idx.end(), std::mt19937(12345));
+    return &idx[0];
+  }
+};
+
+static GatherData& gather_data()
+{
+  static GatherData data;
+  return data;
+}
+
+static void benchmark_gather_forall(benchmark::State& state)
+{
+  GatherData& data = gather_data();
+  double* x = &data.x[0];
+  double* y = &data.y[0];
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::loop_exec>(data.list, [=](RAJA::Index_type i) {
+      y[i] += 0.5 * x[i];
+    });
+    benchmark::DoNotOptimize(y[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+template <camp::idx_t Distance>
+static void benchmark_gather_prefetch(benchmark::State& state)
+{
+  GatherData& data = gather_data();
+  double* x = &data.x[0];
+  double* y = &data.y[0];
+
+  while (state.KeepRunning()) {
+    RAJA::forall_prefetch<RAJA::loop_exec, Distance>(
+        data.list, RAJA::make_tuple(x, y), [=](RAJA::Index_type i) {
+          y[i] += 0.5 * x[i];
+        });
+    benchmark::DoNotOptimize(y[0]);
+  }
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+BENCHMARK(benchmark_gather_forall);
+BENCHMARK_TEMPLATE(benchmark_gather_prefetch, 0);
+BENCHMARK_TEMPLATE(benchmark_gather_prefetch, 4);
+BENCHMARK_TEMPLATE(benchmark_gather_prefetch, 16);
+BENCHMARK_TEMPLATE(benchmark_gather_prefetch, 64);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,476 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Thread scaling of the core RAJA patterns (forall triad, ReduceSum,
+// inclusive_scan, sort and a WorkGroup of short loops) with the OpenMP and
+// TBB backends.  For each thread count the patterns are timed on a fixed
+// problem (strong scaling) and on a problem proportional to the number of
+// threads (weak scaling), and the efficiencies relative to one thread of
+// the same backend are printed as tables.  OpenMP thread counts are set
+// with omp_set_num_threads, TBB ones with a task_arena of that size.
+//
+// The thread placement (OMP_PLACES, OMP_PROC_BIND, the places and the CPU
+// of each OpenMP thread, and the CPUs the process may run on) is printed
+// first, since the scaling depends on it.
+//
+// Usage: thread-scaling [--threads=1,2,4,...] [--size=<elements>]
+//                       [--weak-size=<elements per thread>]
+//                       [--repeats=<count>] [--csv=<file>]
+//
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/util/Timer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+#include <tbb/task_arena.h>
+#endif
+
+struct Options {
+  std::vector<int> threads;
+  RAJA::Index_type size = RAJA::Index_type(1) << 25;
+  RAJA::Index_type weak_size = RAJA::Index_type(1) << 20;
+  int repeats = 5;
+  std::string csv;
+};
+
+template <typename ExecPolicy_, typename ReducePolicy_, typename WorkPolicy_>
+struct Policies {
+  using ExecPolicy = ExecPolicy_;
+  using ReducePolicy = ReducePolicy_;
+  using WorkPolicy = WorkPolicy_;
+};
+
+//
+// The patterns, each returning its best time in seconds over the repeats.
+// The data is first touched by the threads that use it.
+//
+
+template <typename Loop>
+static double best_time(int repeats, Loop&& loop)
+{
+  double best = std::numeric_limits<double>::max();
+  for (int r = 0; r < repeats; ++r) {
+    RAJA::Timer timer;
+    timer.start();
+    loop();
+    timer.stop();
+    best = std::min(best, timer.elapsed());
+  }
+  return best;
+}
+
+template <typename P>
+static double time_triad(RAJA::Index_type n, int repeats)
+{
+  std::unique_ptr<double[]> a(new double[n]), b(new double[n]),
+      c(new double[n]);
+  double *pa = a.get(), *pb = b.get(), *pc = c.get();
+  RAJA::forall<typename P::ExecPolicy>(RAJA::RangeSegment(0, n),
+                                       [=](RAJA::Index_type i) {
+                                         pa[i] = 0.0;
+                                         pb[i] = 1.0;
+                                         pc[i] = 2.0;
+                                       });
+
+  return best_time(repeats, [=]() {
+    RAJA::forall<typename P::ExecPolicy>(RAJA::RangeSegment(0, n),
+                                         [=](RAJA::Index_type i) {
+                                           pa[i] = pb[i] + 3.0 * pc[i];
+                                         });
+  });
+}
+
+template <typename P>
+static double time_reduce(RAJA::Index_type n, int repeats)
+{
+  std::unique_ptr<double[]> x(new double[n]);
+  double* px = x.get();
+  RAJA::forall<typename P::ExecPolicy>(RAJA::RangeSegment(0, n),
+                                       [=](RAJA::Index_type i) {
+                                         px[i] = 1.0;
+                                       });
+
+  volatile double sink = 0.0;
+  return best_time(repeats, [=, &sink]() {
+    RAJA::ReduceSum<typename P::ReducePolicy, double> sum(0.0);
+    RAJA::forall<typename P::ExecPolicy>(RAJA::RangeSegment(0, n),
+                                         [=](RAJA::Index_type i) {
+                                           sum += px[i];
+                                         });
+    sink = sum.get();
+  });
+}
+
+template <typename P>
+static double time_scan(RAJA::Index_type n, int repeats)
+{
+  std::unique_ptr<int[]> in(new int[n]), out(new int[n]);
+  int *pin = in.get(), *pout = out.get();
+  RAJA::forall<typename P::ExecPolicy>(RAJA::RangeSegment(0, n),
+                                       [=](RAJA::Index_type i) {
+                                         pin[i] = int(i % 3);
+                                         pout[i] = 0;
+                                       });
+
+  return best_time(repeats, [=]() {
+    RAJA::inclusive_scan<typename P::ExecPolicy>(pin, pin + n, pout);
+  });
+}
+
+template <typename P>
+static double time_sort(RAJA::Index_type n, int repeats)
+{
+  std::unique_ptr<int[]> values(new int[n]), keys(new int[n]);
+  int *pvalues = values.get(), *pkeys = keys.get();
+  RAJA::forall<typename P::ExecPolicy>(RAJA::RangeSegment(0, n),
+                                       [=](RAJA::Index_type i) {
+                                         pvalues[i] = int((i * 7919) % n);
+                                         pkeys[i] = 0;
+                                       });
+
+  // only the sort is timed, not restoring the unsorted keys
+  double best = std::numeric_limits<double>::max();
+  for (int r = 0; r < repeats; ++r) {
+    RAJA::forall<typename P::ExecPolicy>(RAJA::RangeSegment(0, n),
+                                         [=](RAJA::Index_type i) {
+                                           pkeys[i] = pvalues[i];
+                                         });
+    best = std::min(best, best_time(1, [=]() {
+                      RAJA::sort<typename P::ExecPolicy>(pkeys, pkeys + n);
+                    }));
+  }
+  return best;
+}
+
+template <typename P>
+static double time_workgroup(RAJA::Index_type n, int repeats)
+{
+  using policy = RAJA::WorkGroupPolicy<typename P::WorkPolicy,
+                                       RAJA::ordered,
+                                       RAJA::ragged_array_of_objects>;
+  using allocator = std::allocator<char>;
+  using workpool =
+      RAJA::WorkPool<policy, RAJA::Index_type, RAJA::xargs<>, allocator>;
+  using workgroup =
+      RAJA::WorkGroup<policy, RAJA::Index_type, RAJA::xargs<>, allocator>;
+  using worksite =
+      RAJA::WorkSite<policy, RAJA::Index_type, RAJA::xargs<>, allocator>;
+
+  // short loops, as when packing the faces of many small domains
+  const RAJA::Index_type len = 4096;
+  const RAJA::Index_type num_loops = std::max(RAJA::Index_type(1), n / len);
+
+  std::unique_ptr<double[]> x(new double[num_loops * len]),
+      y(new double[num_loops * len]);
+  double *px = x.get(), *py = y.get();
+  RAJA::forall<typename P::ExecPolicy>(RAJA::RangeSegment(0, num_loops * len),
+                                       [=](RAJA::Index_type i) {
+                                         px[i] = 1.0;
+                                         py[i] = 0.0;
+                                       });
+
+  workpool pool(allocator{});
+  return best_time(repeats, [&]() {
+    for (RAJA::Index_type l = 0; l < num_loops; ++l) {
+      const double* lx = px + l * len;
+      double* ly = py + l * len;
+      pool.enqueue(RAJA::TypedRangeSegment<RAJA::Index_type>(0, len),
+                   [=](RAJA::Index_type i) { ly[i] += 2.0 * lx[i]; });
+    }
+    workgroup group = pool.instantiate();
+    worksite site = group.run();
+  });
+}
+
+//
+// Strong and weak scaling of one pattern for one backend.
+//
+
+struct ScalingRow {
+  int threads;
+  double strong_time;
+  double weak_time;
+};
+
+static void print_table(const char* backend,
+                        const char* pattern,
+                        Options const& opts,
+                        std::vector<ScalingRow> const& rows,
+                        FILE* csv)
+{
+  printf("\n%s %s (strong: %ld elements, weak: %ld elements per thread)\n",
+         backend,
+         pattern,
+         long(opts.size),
+         long(opts.weak_size));
+  printf("%8s %12s %9s %11s %12s %11s\n",
+         "threads",
+         "strong_s",
+         "speedup",
+         "strong_eff",
+         "weak_s",
+         "weak_eff");
+
+  const ScalingRow& base = rows.front();
+  for (auto const& row : rows) {
+    const double speedup = base.strong_time / row.strong_time;
+    const double strong_eff = speedup * base.threads / row.threads;
+    const double weak_eff = base.weak_time / row.weak_time;
+    printf("%8d %12.6f %9.2f %11.3f %12.6f %11.3f\n",
+           row.threads,
+           row.strong_time,
+           speedup,
+           strong_eff,
+           row.weak_time,
+           weak_eff);
+    if (csv) {
+      fprintf(csv,
+              "%s,%s,%d,%g,%g,%g,%g,%g\n",
+              backend,
+              pattern,
+              row.threads,
+              row.strong_time,
+              speedup,
+              strong_eff,
+              row.weak_time,
+              weak_eff);
+    }
+  }
+}
+
+//
+// Runs each pattern with every thread count, using with_threads(t, f) to
+// call f with t threads.
+//
+template <typename P, typename WithThreads>
+static void scale_backend(const char* backend,
+                          Options const& opts,
+                          FILE* csv,
+                          WithThreads&& with_threads)
+{
+  struct Pattern {
+    const char* name;
+    double (*time)(RAJA::Index_type, int);
+  };
+  const Pattern patterns[] = {{"forall triad", &time_triad<P>},
+                              {"ReduceSum", &time_reduce<P>},
+                              {"inclusive_scan", &time_scan<P>},
+                              {"sort", &time_sort<P>},
+                              {"WorkGroup", &time_workgroup<P>}};
+
+  for (auto const& pattern : patterns) {
+    std::vector<ScalingRow> rows;
+    for (int t : opts.threads) {
+      ScalingRow row;
+      row.threads = t;
+      row.strong_time = with_threads(t, [&]() {
+        return pattern.time(opts.size, opts.repeats);
+      });
+      row.weak_time = with_threads(t, [&]() {
+        return pattern.time(opts.weak_size * t, opts.repeats);
+      });
+      rows.push_back(row);
+    }
+    print_table(backend, pattern.name, opts, rows, csv);
+  }
+}
+
+//
+// Thread placement
+//
+
+static void print_placement(FILE* out, const char* prefix)
+{
+  const char* places = getenv("OMP_PLACES");
+  const char* bind = getenv("OMP_PROC_BIND");
+  fprintf(out, "%sOMP_PLACES=%s\n", prefix, places ? places : "(unset)");
+  fprintf(out, "%sOMP_PROC_BIND=%s\n", prefix, bind ? bind : "(unset)");
+
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    fprintf(out, "%sprocess CPUs (%d):", prefix, CPU_COUNT(&set));
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &set)) {
+        fprintf(out, " %d", cpu);
+      }
+    }
+    fprintf(out, "\n");
+  }
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP)
+  static const char* bind_names[] = {
+      "false", "true", "master", "close", "spread"};
+  const int proc_bind = int(omp_get_proc_bind());
+  fprintf(out,
+          "%somp_get_proc_bind=%s\n",
+          prefix,
+          proc_bind >= 0 && proc_bind < 5 ? bind_names[proc_bind] : "unknown");
+#if _OPENMP >= 201511
+  fprintf(out, "%somp_get_num_places=%d\n", prefix, omp_get_num_places());
+#endif
+
+  // where each thread of a full team runs
+  std::vector<int> place(omp_get_max_threads(), -1);
+  std::vector<int> cpu(omp_get_max_threads(), -1);
+#pragma omp parallel
+  {
+    const int t = omp_get_thread_num();
+    if (t < int(cpu.size())) {
+#if _OPENMP >= 201511
+      place[t] = omp_get_place_num();
+#endif
+#if defined(__linux__)
+      cpu[t] = sched_getcpu();
+#endif
+    }
+  }
+  fprintf(out, "%sOpenMP thread:place/cpu:", prefix);
+  for (size_t t = 0; t < cpu.size(); ++t) {
+    fprintf(out, " %zu:%d/%d", t, place[t], cpu[t]);
+  }
+  fprintf(out, "\n");
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+  fprintf(out,
+          "%sTBB max_concurrency=%d (TBB threads are not pinned)\n",
+          prefix,
+          tbb::this_task_arena::max_concurrency());
+#endif
+}
+
+static std::vector<int> default_threads(int max_threads)
+{
+  std::vector<int> threads;
+  for (int t = 1; t < max_threads; t *= 2) {
+    threads.push_back(t);
+  }
+  threads.push_back(max_threads);
+  return threads;
+}
+
+static bool parse_options(int argc, char** argv, Options& opts)
+{
+  for (int a = 1; a < argc; ++a) {
+    const char* arg = argv[a];
+    if (strncmp(arg, "--threads=", 10) == 0) {
+      for (const char* p = arg + 10; *p;) {
+        const int t = atoi(p);
+        if (t > 0) {
+          opts.threads.push_back(t);
+        }
+        p = strchr(p, ',');
+        if (!p) break;
+        ++p;
+      }
+    } else if (strncmp(arg, "--size=", 7) == 0) {
+      opts.size = atol(arg + 7);
+    } else if (strncmp(arg, "--weak-size=", 12) == 0) {
+      opts.weak_size = atol(arg + 12);
+    } else if (strncmp(arg, "--repeats=", 10) == 0) {
+      opts.repeats = std::max(1, atoi(arg + 10));
+    } else if (strncmp(arg, "--csv=", 6) == 0) {
+      opts.csv = arg + 6;
+    } else {
+      return false;
+    }
+  }
+  return opts.size > 0 && opts.weak_size > 0;
+}
+
+int main(int argc, char** argv)
+{
+  Options opts;
+  if (!parse_options(argc, argv, opts)) {
+    printf("Usage: %s [--threads=1,2,4,...] [--size=<elements>]\n"
+           "       [--weak-size=<elements per thread>] [--repeats=<count>]\n"
+           "       [--csv=<file>]\n",
+           argv[0]);
+    return 1;
+  }
+
+  FILE* csv = nullptr;
+  if (!opts.csv.empty()) {
+    csv = fopen(opts.csv.c_str(), "w");
+    if (!csv) {
+      printf("Could not open %s\n", opts.csv.c_str());
+      return 1;
+    }
+    print_placement(csv, "# ");
+    fprintf(csv,
+            "backend,pattern,threads,strong_s,speedup,strong_eff,weak_s,"
+            "weak_eff\n");
+  }
+  print_placement(stdout, "");
+
+#if defined(RAJA_ENABLE_OPENMP)
+  {
+    Options omp_opts = opts;
+    if (omp_opts.threads.empty()) {
+      omp_opts.threads = default_threads(omp_get_max_threads());
+    }
+    const int max_threads = omp_get_max_threads();
+    scale_backend<Policies<RAJA::omp_parallel_for_exec,
+                           RAJA::omp_reduce,
+                           RAJA::omp_work>>(
+        "OpenMP", omp_opts, csv, [](int t, std::function<double()> f) {
+          omp_set_num_threads(t);
+          return f();
+        });
+    omp_set_num_threads(max_threads);
+  }
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+  {
+    Options tbb_opts = opts;
+    if (tbb_opts.threads.empty()) {
+      tbb_opts.threads =
+          default_threads(tbb::this_task_arena::max_concurrency());
+    }
+    scale_backend<
+        Policies<RAJA::tbb_for_exec, RAJA::tbb_reduce, RAJA::tbb_work>>(
+        "TBB", tbb_opts, csv, [](int t, std::function<double()> f) {
+          tbb::task_arena arena(t);
+          double time = 0.0;
+          arena.execute([&]() { time = f(); });
+          return time;
+        });
+  }
+#endif
+
+#if !defined(RAJA_ENABLE_OPENMP) && !defined(RAJA_ENABLE_TBB)
+  printf("\nNo threaded backend is enabled; configure RAJA with OpenMP or "
+         "TBB.\n");
+#endif
+
+  if (csv) {
+    fclose(csv);
+  }
+  return 0;
+}
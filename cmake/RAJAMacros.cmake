@@ -146,7 +146,10 @@ macro(raja_add_benchmark)
     DEPENDS_ON ${arg_DEPENDS_ON}
     BENCHMARK On)
 
+  # results are kept as JSON, to compare them across builds and releases
   blt_add_benchmark(
     NAME ${arg_NAME}
-    COMMAND ${TEST_DRIVER} ${arg_NAME})
+    COMMAND ${TEST_DRIVER} ${arg_NAME}
+            --benchmark_out=${CMAKE_BINARY_DIR}/benchmark/${arg_NAME}.json
+            --benchmark_out_format=json)
 endmacro(raja_add_benchmark)
@@ -61,6 +61,11 @@
 //
 #include "RAJA/policy/simd.hpp"
 
+//
+// Explicit vector execution, on native registers where available.
+//
+#include "RAJA/policy/vector.hpp"
+
 #if defined(RAJA_ENABLE_TBB)
 #include "RAJA/policy/tbb.hpp"
 #endif
@@ -95,6 +100,7 @@
 //
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
+#include "RAJA/pattern/prefetch.hpp"
 
 #include "RAJA/policy/MultiPolicy.hpp"
 
@@ -103,10 +109,14 @@
 // Multidimensional layouts and views
 //
 #include "RAJA/util/Layout.hpp"
+#include "RAJA/util/HilbertLayout.hpp"
+#include "RAJA/util/MixedLayout.hpp"
+#include "RAJA/util/MortonLayout.hpp"
 #include "RAJA/util/OffsetLayout.hpp"
 #include "RAJA/util/PermutedLayout.hpp"
 #include "RAJA/util/StaticLayout.hpp"
 #include "RAJA/util/View.hpp"
+#include "RAJA/util/AoSoA.hpp"
 
 
 //
@@ -337,12 +337,49 @@ RAJA_INLINE concepts::enable_if_t<
     resources::EventProxy<Res>,
     type_traits::is_indexset_policy<ExecutionPolicy>>
 forall(ExecutionPolicy&& p, Res &r, IdxSet&& c, LoopBody&& loop_body)
+{
+  return forall(std::forward<ExecutionPolicy>(p),
+                r,
+                Name(),
+                std::forward<IdxSet>(c),
+                std::forward<LoopBody>(loop_body));
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over index set with a value-based policy and a
+ *        kernel name for the plugins
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename IdxSet, typename LoopBody,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type >
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_indexset_policy<ExecutionPolicy>>
+forall(ExecutionPolicy&& p, Name name, IdxSet&& c, LoopBody&& loop_body)
+{
+  auto r = Res::get_default();
+  return forall(std::forward<ExecutionPolicy>(p),
+                r,
+                name,
+                std::forward<IdxSet>(c),
+                std::forward<LoopBody>(loop_body));
+}
+template <typename ExecutionPolicy, typename Res, typename IdxSet, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    type_traits::is_indexset_policy<ExecutionPolicy>>
+forall(ExecutionPolicy&& p, Res &r, Name name, IdxSet&& c, LoopBody&& loop_body)
 {
   static_assert(type_traits::is_index_set<IdxSet>::value,
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  // the length of an index set is a sum over its segments
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      name, util::plugins_active() ? c.getLength() : 0)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -484,11 +521,52 @@ RAJA_INLINE concepts::enable_if_t<
     concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
     type_traits::is_range<Container>>
 forall(ExecutionPolicy&& p, Res &r, Container&& c, LoopBody&& loop_body)
+{
+  return forall(std::forward<ExecutionPolicy>(p),
+                r,
+                Name(),
+                std::forward<Container>(c),
+                std::forward<LoopBody>(loop_body));
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generic dispatch over containers with a value-based policy and a
+ *        kernel name for the plugins
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename Container, typename LoopBody,
+          typename Res = typename resources::get_resource<ExecutionPolicy>::type >
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>>
+forall(ExecutionPolicy&& p, Name name, Container&& c, LoopBody&& loop_body)
+{
+  auto r = Res::get_default();
+  return forall(std::forward<ExecutionPolicy>(p),
+                r,
+                name,
+                std::forward<Container>(c),
+                std::forward<LoopBody>(loop_body));
+}
+
+template <typename ExecutionPolicy, typename Res, typename Container, typename LoopBody>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_indexset_policy<ExecutionPolicy>>,
+    concepts::negate<type_traits::is_multi_policy<ExecutionPolicy>>,
+    type_traits::is_range<Container>>
+forall(ExecutionPolicy&& p, Res &r, Name name, Container&& c, LoopBody&& loop_body)
 {
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>(
+      name, std::distance(std::begin(c), std::end(c)))};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
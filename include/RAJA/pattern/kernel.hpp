@@ -20,6 +20,9 @@
 
 #include "RAJA/config.hpp"
 
+#include <cstddef>
+#include <iterator>
+
 #include "RAJA/internal/get_platform.hpp"
 #include "RAJA/util/plugins.hpp"
 
@@ -96,15 +99,46 @@ RAJA_INLINE constexpr auto make_wrapped_tuple(Tuple &&t)
 }
 
 
+namespace internal
+{
+//! Number of iterates of a kernel: the product of its segment lengths
+template <typename SegmentTuple, camp::idx_t... I>
+RAJA_INLINE std::size_t kernel_iterations(SegmentTuple const &segments,
+                                          camp::idx_seq<I...>)
+{
+  std::size_t num = 1;
+  int expand[] = {0,
+                  (num *= std::distance(std::begin(camp::get<I>(segments)),
+                                        std::end(camp::get<I>(segments))),
+                   0)...};
+  (void)expand;
+  return num;
+}
+}  // namespace internal
+
+
+/*!
+ * RAJA::kernel_param with a kernel name for the plugins:
+ *
+ *   RAJA::kernel_param<Pol>(RAJA::Name("stencil"), segments, params, body);
+ */
 template <typename PolicyType,
           typename SegmentTuple,
           typename ParamTuple,
           typename... Bodies>
-RAJA_INLINE void kernel_param(SegmentTuple &&segments,
+RAJA_INLINE void kernel_param(Name name,
+                              SegmentTuple &&segments,
                               ParamTuple &&params,
                               Bodies &&... bodies)
 {
-  util::PluginContext context{util::make_context<PolicyType>()};
+  util::PluginContext context{util::make_context<PolicyType>(
+      name,
+      util::plugins_active()
+          ? internal::kernel_iterations(
+                segments,
+                camp::make_idx_seq_t<
+                    camp::tuple_size<camp::decay<SegmentTuple>>::value>{})
+          : 0)};
 
   // TODO: test that all policy members model the Executor policy concept
   // TODO: add a static_assert for functors which cannot be invoked with
@@ -146,6 +180,29 @@ RAJA_INLINE void kernel_param(SegmentTuple &&segments,
   util::callPostLaunchPlugins(context);
 }
 
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename ParamTuple,
+          typename... Bodies>
+RAJA_INLINE void kernel_param(SegmentTuple &&segments,
+                              ParamTuple &&params,
+                              Bodies &&... bodies)
+{
+  RAJA::kernel_param<PolicyType>(Name(),
+                                 std::forward<SegmentTuple>(segments),
+                                 std::forward<ParamTuple>(params),
+                                 std::forward<Bodies>(bodies)...);
+}
+
+template <typename PolicyType, typename SegmentTuple, typename... Bodies>
+RAJA_INLINE void kernel(Name name, SegmentTuple &&segments, Bodies &&... bodies)
+{
+  RAJA::kernel_param<PolicyType>(name,
+                                 std::forward<SegmentTuple>(segments),
+                                 RAJA::make_tuple(),
+                                 std::forward<Bodies>(bodies)...);
+}
+
 template <typename PolicyType, typename SegmentTuple, typename... Bodies>
 RAJA_INLINE void kernel(SegmentTuple &&segments, Bodies &&... bodies)
 {
@@ -166,10 +223,13 @@ RAJA_INLINE void kernel(SegmentTuple &&segments, Bodies &&... bodies)
 #include "RAJA/pattern/kernel/InitLocalMem.hpp"
 #include "RAJA/pattern/kernel/Lambda.hpp"
 #include "RAJA/pattern/kernel/Param.hpp"
+#include "RAJA/pattern/kernel/Prefetch.hpp"
+#include "RAJA/pattern/kernel/RecursiveTile.hpp"
 #include "RAJA/pattern/kernel/Reduce.hpp"
 #include "RAJA/pattern/kernel/Region.hpp"
 #include "RAJA/pattern/kernel/Tile.hpp"
 #include "RAJA/pattern/kernel/TileTCount.hpp"
+#include "RAJA/pattern/kernel/Unroll.hpp"
 
 
 #endif /* RAJA_pattern_kernel_HPP */
@@ -34,6 +34,21 @@ struct Collapse : public internal::ForList,
 
 
 }  // namespace statement
+
+namespace internal
+{
+
+/*!
+ * The forall policy with which statements that split up a Collapse (such as
+ * Hyperplane) run a single loop under the Collapse policy.  Collapse
+ * policies that are not also forall policies specialize this.
+ */
+template <typename CollapsePolicy>
+struct CollapseForallPolicy {
+  using type = CollapsePolicy;
+};
+
+}  // namespace internal
 }  // end namespace RAJA
 
 
@@ -25,7 +25,9 @@
 
 #include "camp/camp.hpp"
 
+#include "RAJA/pattern/kernel/Collapse.hpp"
 #include "RAJA/pattern/kernel/For.hpp"
+#include "RAJA/policy/loop/policy.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -42,7 +44,7 @@ namespace statement
  * Given segments S0, S1, ...
  * and iterates i0, i1, ... that range from 0 to Ni, where Ni = length(Si),
  * hyperplanes are defined as h = i0 + i1 + i2 + ...
- * For h = 0 ... sum(Ni)
+ * For h = 0 ... sum(Ni - 1)
  *
  * The iteration is advanced for
  *
@@ -51,27 +53,29 @@ namespace statement
  * Where HpArg is the argument id for i0, and Args define the arguments ids for
  * i1, i2, ...
  *
- *
- *
+ * Only the points that lie on each hyperplane are enumerated: the bounds of
+ * every inner loop are computed from h and the loops outside of it, so that
+ * i0 always falls inside S0.  The loop over i1 is executed with ExecPolicy
+ * (for Collapse policies, the matching forall policy), and the loops over
+ * i2, ... sequentially inside it.
  *
  * The implemented loop pattern looks like:
  *
  *  RAJA::forall<HpExecPolicy>(RangeSegment(0, Nh), [=](RAJA::Index_type h){
  *
- *     RAJA::kernel::forall<Collapse<ExecPolicy, ArgList<1,2,...>, Lambda<0>>>(
- *        RAJA::make_tuple(S1, S2, ...),
- *        [=](RAJA::Index_type i1, RAJA::Index_type i2, ...){
+ *     RAJA::forall<ExecPolicy>(RangeSegment(i1_begin(h), i1_end(h)),
+ *        [=](RAJA::Index_type i1){
  *
- *          // Compute i0
- *          RAJA::Index_type i0 = h - sum(i1, i2, ...);
+ *        for(i2 = i2_begin(h, i1); i2 < i2_end(h, i1); ++i2){
+ *          ...
  *
- *          // Check if h is in bounds
- *          if(h >= 0 && h < Nh){
+ *            // Compute i0, which is always in bounds
+ *            RAJA::Index_type i0 = h - sum(i1, i2, ...);
  *
-              loop_body(i0, i1, i2, ...);
- *          }
+ *            loop_body(i0, i1, i2, ...);
+ *        }
  *
- *        });
+ *     });
  *
  *  });
  *
@@ -92,9 +96,18 @@ namespace internal
 {
 
 
-template <camp::idx_t HpArgumentId, typename ArgList, typename... EnclosedStmts>
+/*!
+ * Executes the loops over TodoArgs for a fixed hyperplane h, which is held
+ * in the offset of HpArgumentId, given the offsets of the DoneArgs.  The
+ * first of TodoArgs is run with ExecPolicy, the rest with loop_exec.
+ */
+template <camp::idx_t HpArgumentId,
+          typename ExecPolicy,
+          typename DoneArgs,
+          typename TodoArgs,
+          typename... EnclosedStmts>
 struct HyperplaneInner
-    : public internal::Statement<camp::nil, EnclosedStmts...> {
+    : public internal::Statement<ExecPolicy, EnclosedStmts...> {
 };
 
 
@@ -123,27 +136,35 @@ struct StatementExecutor<statement::Hyperplane<HpArgumentId,
     // Set the argument type for this loop
     using NewTypes = setSegmentTypeFromData<Types, HpArgumentId, Data>;
 
-    // Add a Collapse policy around our enclosed statements that will handle
-    // the inner hyperplane loop's execution
-    using kernel_policy = statement::Collapse<
-        ExecPolicy,
-        ArgList<Args...>,
-        HyperplaneInner<HpArgumentId, ArgList<Args...>, EnclosedStmts...>>;
+    // Enumerate the points of each hyperplane with exact bounds
+    using inner_policy =
+        HyperplaneInner<HpArgumentId,
+                        typename CollapseForallPolicy<ExecPolicy>::type,
+                        ArgList<>,
+                        ArgList<Args...>,
+                        EnclosedStmts...>;
 
     // Create a For-loop wrapper for the outer loop
-    ForWrapper<HpArgumentId, Data, NewTypes, kernel_policy> outer_wrapper(data);
+    ForWrapper<HpArgumentId, Data, NewTypes, inner_policy> outer_wrapper(data);
+
+    bool const non_empty =
+        foldl(RAJA::operators::logical_and<bool>(),
+              (segment_length<HpArgumentId>(data) > 0),
+              (segment_length<Args>(data) > 0)...);
+    if (!non_empty) {
+      return;
+    }
 
-    // compute manhattan distance of iteration space to determine
-    // as:  hp_len = l0 + l1 + l2 + ...
-    idx_t hp_len = segment_length<HpArgumentId>(data) +
-                   foldl(RAJA::operators::plus<idx_t>(),
-                                 segment_length<Args>(data)...);
+    // compute number of hyperplanes, which is one more than the largest h
+    // as:  hp_len = (l0-1) + (l1-1) + (l2-1) + ... + 1
+    idx_t hp_len = RAJA::sum<idx_t>(idx_t(segment_length<HpArgumentId>(data)),
+                                    idx_t(segment_length<Args>(data) - 1)...);
 
     /* Execute the outer loop over hyperplanes
      *
      * This will store h in the index_tuple as argument HpArgumentId, so that
-     * later, the HyperplaneInner executor can pull it out, and calculate that
-     * arguments actual value (and restrict to valid hyperplane indices)
+     * later, the HyperplaneInner executors can pull it out, and calculate the
+     * bounds of the other arguments and that argument's actual value
      */
     auto r = resources::get_resource<HpExecPolicy>::type::get_default();
     forall_impl(r, HpExecPolicy{},
@@ -154,11 +175,17 @@ struct StatementExecutor<statement::Hyperplane<HpArgumentId,
 
 
 template <camp::idx_t HpArgumentId,
-          camp::idx_t... Args,
+          typename ExecPolicy,
+          camp::idx_t... DoneArgs,
+          camp::idx_t Arg,
+          camp::idx_t... RestArgs,
           typename... EnclosedStmts,
           typename Types>
-struct StatementExecutor<
-    HyperplaneInner<HpArgumentId, ArgList<Args...>, EnclosedStmts...>, Types> {
+struct StatementExecutor<HyperplaneInner<HpArgumentId,
+                                         ExecPolicy,
+                                         ArgList<DoneArgs...>,
+                                         ArgList<Arg, RestArgs...>,
+                                         EnclosedStmts...>, Types> {
 
 
   template <typename Data>
@@ -169,26 +196,72 @@ struct StatementExecutor<
     auto h = camp::get<HpArgumentId>(data.offset_tuple);
     using idx_t = decltype(h);
 
-    // compute actual iterate for HpArgumentId
-    // as:  i0 = h - (i1 + i2 + i3 + ...)
-    idx_t i = h - foldl(RAJA::operators::plus<idx_t>(),
-                                camp::get<Args>(data.offset_tuple)...);
+    // what is left of h for Arg, RestArgs and HpArgumentId
+    idx_t left = h - RAJA::sum<idx_t>(idx_t(0),
+                                      camp::get<DoneArgs>(data.offset_tuple)...);
 
-    // get length of Hp indexed argument
-    auto len = segment_length<HpArgumentId>(data);
+    // RestArgs and HpArgumentId can take up anything from 0 to rest_max
+    idx_t rest_max =
+        RAJA::sum<idx_t>(idx_t(segment_length<HpArgumentId>(data) - 1),
+                         idx_t(segment_length<RestArgs>(data) - 1)...);
 
-    // check bounds
-    if (i >= 0 && i < len) {
+    idx_t begin = left > rest_max ? left - rest_max : idx_t(0);
+    idx_t end = RAJA::operators::minimum<idx_t>{}(
+        idx_t(segment_length<Arg>(data)), left + 1);
 
-      // store in tuple
-      data.template assign_offset<HpArgumentId>(i);
+    // Set the argument type for this loop
+    using NewTypes = setSegmentTypeFromData<Types, Arg, Data>;
 
-      // execute enclosed statements
-      execute_statement_list<StatementList<EnclosedStmts...>, Types>(data);
+    using inner_policy = HyperplaneInner<HpArgumentId,
+                                         loop_exec,
+                                         ArgList<DoneArgs..., Arg>,
+                                         ArgList<RestArgs...>,
+                                         EnclosedStmts...>;
 
-      // reset h for next iteration
-      data.template assign_offset<HpArgumentId>(h);
-    }
+    ForWrapper<Arg, Data, NewTypes, inner_policy> for_wrapper(data);
+
+    auto r = resources::get_resource<ExecPolicy>::type::get_default();
+    forall_impl(r, ExecPolicy{},
+                TypedRangeSegment<idx_t>(begin, end),
+                for_wrapper);
+  }
+};
+
+
+template <camp::idx_t HpArgumentId,
+          typename ExecPolicy,
+          camp::idx_t... DoneArgs,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<HyperplaneInner<HpArgumentId,
+                                         ExecPolicy,
+                                         ArgList<DoneArgs...>,
+                                         ArgList<>,
+                                         EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+
+    // get h value
+    auto h = camp::get<HpArgumentId>(data.offset_tuple);
+    using idx_t = decltype(h);
+
+    // compute actual iterate for HpArgumentId, which the bounds of the
+    // enclosing loops keep in range
+    // as:  i0 = h - (i1 + i2 + i3 + ...)
+    idx_t i = h - RAJA::sum<idx_t>(idx_t(0),
+                                   camp::get<DoneArgs>(data.offset_tuple)...);
+
+    // store in tuple
+    data.template assign_offset<HpArgumentId>(i);
+
+    // execute enclosed statements
+    execute_statement_list<StatementList<EnclosedStmts...>, Types>(data);
+
+    // reset h for next iteration
+    data.template assign_offset<HpArgumentId>(h);
   }
 };
 
@@ -20,14 +20,22 @@
 
 #include "RAJA/config.hpp"
 
+#include <cstddef>
 #include <iostream>
 #include <type_traits>
+#include <vector>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/util/macros.hpp"
 
 namespace RAJA
 {
 
 //Policies for RAJA local arrays
 struct cpu_tile_mem;
+struct cpu_arena_mem;
+struct cpu_team_shared_mem;
 
 
 namespace statement
@@ -52,12 +60,180 @@ template<camp::idx_t... Indices, typename... EnclosedStmts>
 struct InitLocalMem<RAJA::cpu_tile_mem, camp::idx_seq<Indices...>, EnclosedStmts...> : public internal::Statement<camp::nil> {
 };
 
+template<camp::idx_t... Indices, typename... EnclosedStmts>
+struct InitLocalMem<RAJA::cpu_arena_mem, camp::idx_seq<Indices...>, EnclosedStmts...> : public internal::Statement<camp::nil> {
+};
+
+template<camp::idx_t... Indices, typename... EnclosedStmts>
+struct InitLocalMem<RAJA::cpu_team_shared_mem, camp::idx_seq<Indices...>, EnclosedStmts...> : public internal::Statement<camp::nil> {
+};
+
 
 }  // end namespace statement
 
 namespace internal
 {
 
+/*!
+ * Per-thread scratch memory for the cpu_arena_mem and cpu_team_shared_mem
+ * local arrays.
+ *
+ * Each nesting level of InitLocalMem statements on a thread gets its own
+ * block, which is kept between kernels and only reallocated when a larger
+ * request arrives, so a block is never moved while arrays in it are live.
+ */
+class CpuArena
+{
+public:
+  //! Blocks and the arrays in them start on cache line boundaries
+  static constexpr size_t alignment = RAJA::DATA_ALIGN > 64 ? RAJA::DATA_ALIGN : 64;
+
+  static RAJA_INLINE constexpr size_t round_up(size_t bytes)
+  {
+    return (bytes + alignment - 1) / alignment * alignment;
+  }
+
+  //! The arena of the calling thread
+  static CpuArena &get()
+  {
+    static thread_local CpuArena arena;
+    return arena;
+  }
+
+  CpuArena() = default;
+  CpuArena(CpuArena const &) = delete;
+  CpuArena &operator=(CpuArena const &) = delete;
+
+  ~CpuArena()
+  {
+    for (Block &block : m_blocks) {
+      RAJA::free_aligned(block.data);
+    }
+  }
+
+  //! Returns a block of at least bytes bytes for the next nesting level
+  void *acquire(size_t bytes)
+  {
+    if (m_depth == m_blocks.size()) {
+      m_blocks.push_back(Block{nullptr, 0});
+    }
+
+    Block &block = m_blocks[m_depth];
+    if (block.bytes < bytes) {
+      RAJA::free_aligned(block.data);
+      block.data = RAJA::allocate_aligned(alignment, bytes);
+      block.bytes = block.data ? bytes : 0;
+      if (!block.data) {
+        RAJA_ABORT_OR_THROW("CpuArena allocation failed");
+      }
+    }
+
+    ++m_depth;
+    return block.data;
+  }
+
+  //! Gives back the block of the innermost nesting level
+  void release() { --m_depth; }
+
+  /*!
+   * Holds a nesting level of an arena and releases it when destroyed, so
+   * the level is given back when an enclosed statement throws.
+   */
+  class Level
+  {
+  public:
+    Level() = default;
+    Level(CpuArena &arena, size_t bytes) { acquire(arena, bytes); }
+
+    Level(Level const &) = delete;
+    Level &operator=(Level const &) = delete;
+
+    ~Level()
+    {
+      if (m_arena) {
+        m_arena->release();
+      }
+    }
+
+    //! Takes the next nesting level of arena; at most once per Level
+    void *acquire(CpuArena &arena, size_t bytes)
+    {
+      m_data = arena.acquire(bytes);
+      m_arena = &arena;
+      return m_data;
+    }
+
+    void *data() const { return m_data; }
+
+  private:
+    CpuArena *m_arena = nullptr;
+    void *m_data = nullptr;
+  };
+
+private:
+  struct Block {
+    void *data;
+    size_t bytes;
+  };
+
+  std::vector<Block> m_blocks;
+  size_t m_depth = 0;
+};
+
+
+/*!
+ * Places the local arrays Indices of the parameter tuple of Data one after
+ * another, each on an aligned boundary, in memory from a CpuArena.
+ */
+template<typename Data, camp::idx_t... Indices>
+struct CpuArenaLocalMem {
+
+  template<camp::idx_t Pos>
+  using array_t = camp::tuple_element_t<Pos, typename Data::param_tuple_t>;
+
+  template<camp::idx_t Pos>
+  static constexpr size_t array_bytes()
+  {
+    return CpuArena::round_up(sizeof(typename array_t<Pos>::element_t) *
+                              array_t<Pos>::NumElem);
+  }
+
+  //! Total number of bytes needed for the arrays
+  static RAJA_INLINE size_t bytes()
+  {
+    size_t total = 0;
+    for (size_t b : {size_t(0), array_bytes<Indices>()...}) {
+      total += b;
+    }
+    return total;
+  }
+
+  template<camp::idx_t Pos>
+  static RAJA_INLINE void assign_array(Data &data, char *&mem)
+  {
+    using varType = typename array_t<Pos>::element_t;
+    static_assert(std::is_trivial<varType>::value,
+                  "arena local arrays must have trivial element types");
+
+    camp::get<Pos>(data.param_tuple).m_arrayPtr = reinterpret_cast<varType *>(mem);
+    mem += array_bytes<Pos>();
+  }
+
+  //! Points the arrays into mem, which holds at least bytes() bytes
+  static RAJA_INLINE void assign(Data &data, void *mem)
+  {
+    char *next = static_cast<char *>(mem);
+    int expand[] = {0, (assign_array<Indices>(data, next), 0)...};
+    (void)expand;
+  }
+
+  static RAJA_INLINE void clear(Data &data)
+  {
+    camp::sink((camp::get<Indices>(data.param_tuple).m_arrayPtr = nullptr)...);
+  }
+};
+
+
 //Statement executor to initalize RAJA local array
 template<camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
 struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_seq<Indices...>, EnclosedStmts...>, Types>{
@@ -106,6 +282,27 @@ struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_se
 };
 
 
+
+//Statement executor to initalize RAJA local arrays in the thread's arena
+template<camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_arena_mem,camp::idx_seq<Indices...>, EnclosedStmts...>, Types>{
+
+  template<typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using local_mem_t = CpuArenaLocalMem<camp::decay<Data>, Indices...>;
+
+    CpuArena::Level level(CpuArena::get(), local_mem_t::bytes());
+    local_mem_t::assign(data, level.data());
+
+    execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+
+    local_mem_t::clear(data);
+  }
+
+};
+
+
 }  // namespace internal
 }  // end namespace RAJA
 
@@ -0,0 +1,107 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the software prefetch statement.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_Prefetch_HPP
+#define RAJA_pattern_kernel_Prefetch_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/prefetch.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that prefetches data for a later iterate of an
+ * enclosing loop over argument ArgumentId.
+ *
+ * ParamId is a Param<#> holding a pointer or one-dimensional View.  The
+ * element of it at the index of the segment Distance iterates past the
+ * current one is prefetched, and so is the index 2*Distance iterates past
+ * the current one for segments that store their indices (ListSegments).
+ * This hides the memory latency of gathers that hardware prefetchers can
+ * not follow:
+ *
+ *   For<0, loop_exec,
+ *     Prefetch<0, Param<0>, 16>,
+ *     Lambda<0>
+ *   >
+ */
+template <camp::idx_t ArgumentId, typename ParamId, camp::idx_t Distance>
+struct Prefetch : public internal::Statement<camp::nil> {
+
+  static_assert(std::is_base_of<internal::ParamBase, ParamId>::value,
+                "Inappropriate ParamId, ParamId must be of type "
+                "RAJA::Statement::Param< # >");
+  static_assert(Distance > 0, "Prefetch distance must be positive");
+};
+
+
+}  // end namespace statement
+
+namespace internal
+{
+
+/*!
+ * A generic RAJA::kernel executor for statement::Prefetch
+ *
+ */
+template <camp::idx_t ArgumentId,
+          typename ParamId,
+          camp::idx_t Distance,
+          typename Types>
+struct StatementExecutor<statement::Prefetch<ArgumentId, ParamId, Distance>,
+                         Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    auto const len = segment_length<ArgumentId>(data);
+    using len_t = camp::decay<decltype(len)>;
+
+    len_t const offset = camp::get<ArgumentId>(data.offset_tuple);
+    auto const begin = camp::get<ArgumentId>(data.segment_tuple).begin();
+
+    if (offset + len_t(2 * Distance) < len) {
+      util::prefetch_index(begin, offset + len_t(2 * Distance));
+    }
+    if (offset + len_t(Distance) < len) {
+      util::prefetch(
+          util::prefetch_address(camp::get<ParamId::param_idx>(data.param_tuple),
+                                 begin[offset + len_t(Distance)]));
+    }
+  }
+};
+
+
+}  // namespace internal
+}  // end namespace RAJA
+
+
+#endif /* RAJA_pattern_kernel_Prefetch_HPP */
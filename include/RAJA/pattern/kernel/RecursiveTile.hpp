@@ -0,0 +1,211 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the cache-oblivious recursive tiling statement.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_RecursiveTile_HPP
+#define RAJA_pattern_kernel_RecursiveTile_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel/Tile.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that tiles several loops at once by recursive
+ * bisection.
+ *
+ * The segments of the arguments in ArgList are split in half along the
+ * longest one until no segment is longer than Cutoff, and the enclosed
+ * statements are executed on each of the resulting blocks, with the
+ * segments replaced by the block's slices as in statement::Tile, whose
+ * IterableTiler makes the halves.  Blocks are visited depth first, so the
+ * data of the blocks executed together fits in every level of cache without
+ * tuning the tile sizes for it.
+ *
+ * With a sequential ExecPolicy the recursion runs on the calling thread;
+ * omp_parallel_task_exec runs it as OpenMP tasks.
+ *
+ *   RecursiveTile<ArgList<0, 1>, 32, seq_exec,
+ *     For<0, loop_exec, For<1, loop_exec, Lambda<0>>>>
+ */
+template <typename ArgList,
+          camp::idx_t Cutoff,
+          typename ExecPolicy,
+          typename... EnclosedStmts>
+struct RecursiveTile : public internal::Statement<ExecPolicy, EnclosedStmts...> {
+  static_assert(Cutoff > 0, "RecursiveTile cutoff must be positive");
+};
+
+}  // end namespace statement
+
+namespace internal
+{
+
+/*!
+ * Runs the two halves of each split of a RecursiveTile.  The recursion
+ * into the first half is passed to spawn, and the recursion at the top to
+ * run; for ExecPolicies that are not specialized both run Executor::recurse
+ * on the calling thread.
+ */
+template <typename ExecPolicy>
+struct RecursiveTileSpawn {
+
+  template <typename Executor, typename Data>
+  static RAJA_INLINE void spawn(Data &data)
+  {
+    Executor::recurse(data);
+  }
+
+  template <typename Executor, typename Data>
+  static RAJA_INLINE void run(Data &data)
+  {
+    Executor::recurse(data);
+  }
+};
+
+
+template <typename ExecPolicy,
+          typename ArgList,
+          camp::idx_t Cutoff,
+          typename Types,
+          typename... EnclosedStmts>
+struct RecursiveTileExecutor;
+
+template <typename ExecPolicy,
+          camp::idx_t... Args,
+          camp::idx_t Cutoff,
+          typename Types,
+          typename... EnclosedStmts>
+struct RecursiveTileExecutor<ExecPolicy,
+                             ArgList<Args...>,
+                             Cutoff,
+                             Types,
+                             EnclosedStmts...> {
+
+  static_assert(sizeof...(Args) > 0,
+                "RecursiveTile needs at least one argument");
+
+  using spawn_t = RecursiveTileSpawn<ExecPolicy>;
+
+  template <camp::idx_t Arg, typename Data>
+  static RAJA_INLINE void split_arg(Data &data)
+  {
+    auto const segment = camp::get<Arg>(data.segment_tuple);
+    auto const len = segment.end() - segment.begin();
+
+    // The halves are the two tiles that statement::Tile would make of the
+    // segment.  Its TileWrapper is not used, since it runs the enclosed
+    // statements on a tile where a split recurses, on a copy of the data
+    // for a task.
+    IterableTiler<decltype(segment)> halves(
+        segment, static_cast<camp::idx_t>(len - len / 2));
+    auto const first = halves.begin();
+
+    camp::get<Arg>(data.segment_tuple) = first[0].s;
+    spawn_t::template spawn<RecursiveTileExecutor>(data);
+
+    camp::get<Arg>(data.segment_tuple) = first[1].s;
+    recurse(data);
+
+    // Set range back to original values
+    camp::get<Arg>(data.segment_tuple) = segment;
+  }
+
+  template <typename Data, camp::idx_t... Seq>
+  static RAJA_INLINE void split(Data &data,
+                                camp::idx_t dim,
+                                camp::idx_seq<Seq...>)
+  {
+    camp::sink((Seq == dim
+                    ? (split_arg<
+                           camp::seq_at<Seq, camp::idx_seq<Args...>>::value>(
+                           data),
+                       0)
+                    : 0)...);
+  }
+
+  template <typename Data>
+  static void recurse(Data &data)
+  {
+    camp::idx_t const len[] = {
+        static_cast<camp::idx_t>(segment_length<Args>(data))...};
+
+    // find the longest segment
+    camp::idx_t dim = 0;
+    for (camp::idx_t d = 1; d < camp::idx_t(sizeof...(Args)); ++d) {
+      if (len[d] > len[dim]) {
+        dim = d;
+      }
+    }
+
+    if (len[dim] <= Cutoff) {
+      execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+    } else {
+      split(data, dim, camp::make_idx_seq_t<sizeof...(Args)>{});
+    }
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    for (camp::idx_t l : {static_cast<camp::idx_t>(
+             segment_length<Args>(data))...}) {
+      if (l <= 0) {
+        return;
+      }
+    }
+
+    spawn_t::template run<RecursiveTileExecutor>(data);
+  }
+};
+
+
+/*!
+ * A generic RAJA::kernel executor for statement::RecursiveTile
+ *
+ */
+template <typename ArgList,
+          camp::idx_t Cutoff,
+          typename ExecPolicy,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::RecursiveTile<ArgList, Cutoff, ExecPolicy, EnclosedStmts...>,
+    Types>
+    : RecursiveTileExecutor<ExecPolicy,
+                            ArgList,
+                            Cutoff,
+                            Types,
+                            EnclosedStmts...> {
+};
+
+}  // end namespace internal
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_RecursiveTile_HPP */
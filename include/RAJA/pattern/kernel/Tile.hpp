@@ -27,7 +27,9 @@
 #include "camp/concepts.hpp"
 #include "camp/tuple.hpp"
 
+#include "RAJA/internal/foldl.hpp"
 #include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/util/CacheInfo.hpp"
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
@@ -74,6 +76,31 @@ struct tile_dynamic {
   static constexpr camp::idx_t id = ArgumentId;
 };
 
+/*!
+ * Tag for a tiling loop whose tile size is chosen at run time so that a
+ * tile fits in data cache level CacheLevel (1, 2 or 3).
+ *
+ * NumTiledDims is the number of loops tiled with the same policy, and
+ * Elements are the element types of the Views accessed at each point of the
+ * tile, e.g. tile_auto<1, 2, double, double> for a transpose tiled in both
+ * loops.  The size is computed once per kernel, on its first execution.
+ */
+template <int CacheLevel, camp::idx_t NumTiledDims, typename... Elements>
+struct tile_auto {
+  static_assert(NumTiledDims > 0, "tile_auto needs at least one tiled loop");
+  static_assert(sizeof...(Elements) > 0,
+                "tile_auto needs the element types of the tiled Views");
+
+  static constexpr camp::idx_t bytes_per_point =
+      RAJA::sum<camp::idx_t>(camp::idx_t(sizeof(Elements))...);
+
+  static camp::idx_t chunk_size()
+  {
+    return static_cast<camp::idx_t>(util::cache_tile_extent(
+        CacheLevel, NumTiledDims, bytes_per_point));
+  }
+};
+
 
 
 namespace internal
@@ -284,6 +311,51 @@ struct StatementExecutor<
   }
 };
 
+/*!
+ * A generic RAJA::kernel forall_impl executor for statement::Tile with
+ * tile_auto
+ *
+ */
+template <camp::idx_t ArgumentId,
+          int CacheLevel,
+          camp::idx_t NumTiledDims,
+          typename... Elements,
+          typename EPol,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Tile<ArgumentId,
+                    tile_auto<CacheLevel, NumTiledDims, Elements...>,
+                    EPol,
+                    EnclosedStmts...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    // Get the segment we are going to tile
+    auto const &segment = camp::get<ArgumentId>(data.segment_tuple);
+
+    // Get the tiling policies chunk size, computed once for this kernel
+    static const camp::idx_t chunk_size =
+        tile_auto<CacheLevel, NumTiledDims, Elements...>::chunk_size();
+
+    // Create a tile iterator, needs to survive until the forall is
+    // done executing.
+    IterableTiler<decltype(segment)> tiled_iterable(segment, chunk_size);
+
+    // Wrap in case forall_impl needs to thread_privatize
+    TileWrapper<ArgumentId, Data, Types,
+                EnclosedStmts...> tile_wrapper(data);
+
+    // Loop over tiles, executing enclosed statement list
+    auto r = resources::get_resource<EPol>::type::get_default();
+    forall_impl(r, EPol{}, tiled_iterable, tile_wrapper);
+
+    // Set range back to original values
+    camp::get<ArgumentId>(data.segment_tuple) = tiled_iterable.it;
+  }
+};
+
 }  // end namespace internal
 }  // end namespace RAJA
 
@@ -0,0 +1,197 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the compile-time loop unrolling statements.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_Unroll_HPP
+#define RAJA_pattern_kernel_Unroll_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that implements a sequential loop over argument
+ * ArgumentId, unrolled Factor times at compile time.
+ *
+ * The enclosed statements are expanded Factor times per trip, with the
+ * iterates i, i+1, ..., i+Factor-1, and the last length % Factor iterates
+ * are executed by a remainder loop.  The segment length does not need to
+ * be known at compile time.
+ */
+template <camp::idx_t ArgumentId, camp::idx_t Factor, typename... EnclosedStmts>
+struct Unroll : public internal::Statement<camp::nil, EnclosedStmts...> {
+  static_assert(Factor > 0, "Unroll factor must be positive");
+};
+
+
+/*!
+ * A RAJA::kernel statement that unrolls the loop over OuterArgumentId by
+ * Factor and jams the copies into the loop over InnerArgumentId:
+ *
+ *   for (i = 0; i < N0; i += Factor)
+ *     for (j = 0; j < N1; ++j) {
+ *       body(i, j); body(i+1, j); ... body(i+Factor-1, j);
+ *     }
+ *
+ * followed by a remainder loop nest over the last N0 % Factor iterates of
+ * OuterArgumentId.  Both loops are sequential, and the body is executed in
+ * a different order than a For over OuterArgumentId enclosing a For over
+ * InnerArgumentId, which must be valid for the enclosed statements.
+ */
+template <camp::idx_t OuterArgumentId,
+          camp::idx_t InnerArgumentId,
+          camp::idx_t Factor,
+          typename... EnclosedStmts>
+struct UnrollJam : public internal::Statement<camp::nil, EnclosedStmts...> {
+  static_assert(Factor > 0, "UnrollJam factor must be positive");
+};
+
+
+}  // end namespace statement
+
+namespace internal
+{
+
+/*!
+ * Assigns each of Factor consecutive iterates of ArgumentId in turn and
+ * executes the enclosed statements for it.
+ */
+template <camp::idx_t ArgumentId,
+          typename Types,
+          typename... EnclosedStmts,
+          typename Data,
+          typename IndexType,
+          camp::idx_t... Seq>
+RAJA_INLINE void unroll_statement_list(Data &data,
+                                       IndexType i,
+                                       camp::idx_seq<Seq...>)
+{
+  // braced-init-list keeps the copies in order
+  int expand[] = {0,
+                  (data.template assign_offset<ArgumentId>(
+                       i + static_cast<IndexType>(Seq)),
+                   execute_statement_list<camp::list<EnclosedStmts...>, Types>(
+                       data),
+                   0)...};
+  (void)expand;
+}
+
+
+/*!
+ * A generic RAJA::kernel executor for statement::Unroll
+ *
+ */
+template <camp::idx_t ArgumentId,
+          camp::idx_t Factor,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Unroll<ArgumentId, Factor, EnclosedStmts...>, Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    // Set the argument type for this loop
+    using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+    auto len = segment_length<ArgumentId>(data);
+    using len_t = decltype(len);
+
+    len_t i = 0;
+    for (; i + len_t(Factor) <= len; i += len_t(Factor)) {
+      unroll_statement_list<ArgumentId, NewTypes, EnclosedStmts...>(
+          data, i, camp::make_idx_seq_t<Factor>{});
+    }
+
+    // remainder
+    for (; i < len; ++i) {
+      data.template assign_offset<ArgumentId>(i);
+      execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(data);
+    }
+  }
+};
+
+
+/*!
+ * A generic RAJA::kernel executor for statement::UnrollJam
+ *
+ */
+template <camp::idx_t OuterArgumentId,
+          camp::idx_t InnerArgumentId,
+          camp::idx_t Factor,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::UnrollJam<OuterArgumentId,
+                                              InnerArgumentId,
+                                              Factor,
+                                              EnclosedStmts...>,
+                         Types> {
+
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    // Set the argument types for these loops
+    using NewTypes = setSegmentTypesFromData<Types,
+                                             Data,
+                                             OuterArgumentId,
+                                             InnerArgumentId>;
+
+    auto outer_len = segment_length<OuterArgumentId>(data);
+    auto inner_len = segment_length<InnerArgumentId>(data);
+    using outer_t = decltype(outer_len);
+    using inner_t = decltype(inner_len);
+
+    outer_t i = 0;
+    for (; i + outer_t(Factor) <= outer_len; i += outer_t(Factor)) {
+      for (inner_t j = 0; j < inner_len; ++j) {
+        data.template assign_offset<InnerArgumentId>(j);
+        unroll_statement_list<OuterArgumentId, NewTypes, EnclosedStmts...>(
+            data, i, camp::make_idx_seq_t<Factor>{});
+      }
+    }
+
+    // remainder
+    for (; i < outer_len; ++i) {
+      data.template assign_offset<OuterArgumentId>(i);
+      for (inner_t j = 0; j < inner_len; ++j) {
+        data.template assign_offset<InnerArgumentId>(j);
+        execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(data);
+      }
+    }
+  }
+};
+
+
+}  // namespace internal
+}  // end namespace RAJA
+
+
+#endif /* RAJA_pattern_kernel_Unroll_HPP */
@@ -118,6 +118,34 @@ using setSegmentTypeFromData =
     setSegmentType<Types, Segment, camp::at_v<typename camp::decay<Data>::index_tuple_t::TList, Segment>>;
 
 
+template<typename Types, typename Data, camp::idx_t ... Segments>
+struct SetSegmentTypesFromDataHelper;
+
+template<typename Types, typename Data>
+struct SetSegmentTypesFromDataHelper<Types, Data>
+{
+    using type = Types;
+};
+
+template<typename Types,
+         typename Data,
+         camp::idx_t Segment0,
+         camp::idx_t ... SegmentRest>
+struct SetSegmentTypesFromDataHelper<Types, Data, Segment0, SegmentRest...>
+{
+    using type = typename SetSegmentTypesFromDataHelper<
+        setSegmentTypeFromData<Types, Segment0, Data>, Data, SegmentRest...>::type;
+};
+
+/*
+ *  Sets the segment types of several segments at once, as needed by
+ *  statements that assign more than one argument (e.g. Collapse).
+ */
+template<typename Types, typename Data, camp::idx_t ... Segments>
+using setSegmentTypesFromData =
+    typename SetSegmentTypesFromDataHelper<Types, Data, Segments...>::type;
+
+
 }  // end namespace internal
 }  // end namespace RAJA
 
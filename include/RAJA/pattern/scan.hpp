@@ -26,6 +26,7 @@
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/plugins.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 
 namespace RAJA
@@ -63,7 +64,11 @@ inclusive_scan_inplace(const ExecPolicy &p,
   if (begin == end) {
     return;
   }
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(begin, end))};
+  util::callPreLaunchPlugins(context);
   impl::scan::inclusive_inplace(p, begin, end, binop);
+  util::callPostLaunchPlugins(context);
 }
 
 /*!
@@ -100,7 +105,11 @@ exclusive_scan_inplace(const ExecPolicy &p,
   if (begin == end) {
     return;
   }
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(begin, end))};
+  util::callPreLaunchPlugins(context);
   impl::scan::exclusive_inplace(p, begin, end, binop, value);
+  util::callPostLaunchPlugins(context);
 }
 
 /*!
@@ -145,7 +154,11 @@ inclusive_scan(const ExecPolicy &p,
   if (begin == end) {
     return;
   }
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(begin, end))};
+  util::callPreLaunchPlugins(context);
   impl::scan::inclusive(p, begin, end, out, binop);
+  util::callPostLaunchPlugins(context);
 }
 
 /*!
@@ -192,7 +205,11 @@ exclusive_scan(const ExecPolicy &p,
   if (begin == end) {
     return;
   }
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(begin, end))};
+  util::callPreLaunchPlugins(context);
   impl::scan::exclusive(p, begin, end, out, binop, value);
+  util::callPostLaunchPlugins(context);
 }
 
 // =============================================================================
@@ -226,7 +243,11 @@ inclusive_scan_inplace(const ExecPolicy &p,
   if (std::begin(c) == std::end(c)) {
     return;
   }
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(std::begin(c), std::end(c)))};
+  util::callPreLaunchPlugins(context);
   impl::scan::inclusive_inplace(p, std::begin(c), std::end(c), binop);
+  util::callPostLaunchPlugins(context);
 }
 
 /*!
@@ -260,7 +281,11 @@ exclusive_scan_inplace(const ExecPolicy &p,
   if (std::begin(c) == std::end(c)) {
     return;
   }
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(std::begin(c), std::end(c)))};
+  util::callPreLaunchPlugins(context);
   impl::scan::exclusive_inplace(p, std::begin(c), std::end(c), binop, value);
+  util::callPostLaunchPlugins(context);
 }
 
 /*!
@@ -302,7 +327,11 @@ inclusive_scan(const ExecPolicy &p,
   if (std::begin(c) == std::end(c)) {
     return;
   }
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(std::begin(c), std::end(c)))};
+  util::callPreLaunchPlugins(context);
   impl::scan::inclusive(p, std::begin(c), std::end(c), out, binop);
+  util::callPostLaunchPlugins(context);
 }
 
 /*!
@@ -346,7 +375,11 @@ exclusive_scan(const ExecPolicy &p,
   if (std::begin(c) == std::end(c)) {
     return;
   }
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(std::begin(c), std::end(c)))};
+  util::callPreLaunchPlugins(context);
   impl::scan::exclusive(p, std::begin(c), std::end(c), out, binop, value);
+  util::callPostLaunchPlugins(context);
 }
 
 template <typename ExecPolicy, typename... Args>
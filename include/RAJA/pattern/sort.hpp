@@ -26,6 +26,7 @@
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/plugins.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 
 namespace RAJA
@@ -59,7 +60,11 @@ sort(const ExecPolicy &p,
                 "Compare must model BinaryFunction");
   static_assert(type_traits::is_random_access_iterator<Iter>::value,
                 "Iterator must model RandomAccessIterator");
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(begin, end))};
+  util::callPreLaunchPlugins(context);
   impl::sort::unstable(p, begin, end, comp);
+  util::callPostLaunchPlugins(context);
 }
 
 /*!
@@ -90,7 +95,11 @@ stable_sort(const ExecPolicy &p,
                 "Compare must model BinaryFunction");
   static_assert(type_traits::is_random_access_iterator<Iter>::value,
                 "Iterator must model RandomAccessIterator");
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(begin, end))};
+  util::callPreLaunchPlugins(context);
   impl::sort::stable(p, begin, end, comp);
+  util::callPostLaunchPlugins(context);
 }
 
 /*!
@@ -126,7 +135,11 @@ sort_pairs(const ExecPolicy &p,
                 "Keys Iterator must model RandomAccessIterator");
   static_assert(type_traits::is_random_access_iterator<ValIter>::value,
                 "Vals Iterator must model RandomAccessIterator");
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(keys_begin, keys_end))};
+  util::callPreLaunchPlugins(context);
   impl::sort::unstable_pairs(p, keys_begin, keys_end, vals_begin, comp);
+  util::callPostLaunchPlugins(context);
 }
 
 /*!
@@ -162,7 +175,11 @@ stable_sort_pairs(const ExecPolicy &p,
                 "Keys Iterator must model RandomAccessIterator");
   static_assert(type_traits::is_random_access_iterator<ValIter>::value,
                 "Vals Iterator must model RandomAccessIterator");
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(keys_begin, keys_end))};
+  util::callPreLaunchPlugins(context);
   impl::sort::stable_pairs(p, keys_begin, keys_end, vals_begin, comp);
+  util::callPostLaunchPlugins(context);
 }
 
 
@@ -194,7 +211,11 @@ sort(const ExecPolicy &p,
                 "Compare must model BinaryFunction");
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container must model RandomAccessRange");
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(std::begin(c), std::end(c)))};
+  util::callPreLaunchPlugins(context);
   impl::sort::unstable(p, std::begin(c), std::end(c), comp);
+  util::callPostLaunchPlugins(context);
 }
 
 /*!
@@ -223,7 +244,11 @@ stable_sort(const ExecPolicy &p,
                 "Compare must model BinaryFunction");
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container must model RandomAccessRange");
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(std::begin(c), std::end(c)))};
+  util::callPreLaunchPlugins(context);
   impl::sort::stable(p, std::begin(c), std::end(c), comp);
+  util::callPostLaunchPlugins(context);
 }
 
 /*!
@@ -258,7 +283,11 @@ sort_pairs(const ExecPolicy &p,
                 "KeyContainer must model RandomAccessRange");
   static_assert(type_traits::is_random_access_range<ValContainer>::value,
                 "ValContainer must model RandomAccessRange");
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(std::begin(keys), std::end(keys)))};
+  util::callPreLaunchPlugins(context);
   impl::sort::unstable_pairs(p, std::begin(keys), std::end(keys), std::begin(vals), comp);
+  util::callPostLaunchPlugins(context);
 }
 
 /*!
@@ -293,7 +322,11 @@ stable_sort_pairs(const ExecPolicy &p,
                 "KeyContainer must model RandomAccessRange");
   static_assert(type_traits::is_random_access_range<ValContainer>::value,
                 "ValContainer must model RandomAccessRange");
+  util::PluginContext context{util::make_context<ExecPolicy>(
+      Name(), std::distance(std::begin(keys), std::end(keys)))};
+  util::callPreLaunchPlugins(context);
   impl::sort::stable_pairs(p, std::begin(keys), std::end(keys), std::begin(vals), comp);
+  util::callPostLaunchPlugins(context);
 }
 
 
@@ -19,6 +19,7 @@
 #define RAJA_pattern_teams_core_HPP
 
 #include "RAJA/config.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/internal/get_platform.hpp"
 #include "RAJA/util/StaticLayout.hpp"
 #include "RAJA/util/macros.hpp"
@@ -133,11 +134,16 @@ public:
   Threads threads;
   Lanes lanes;
 
+  //! Bytes of team-shared memory available through getSharedMemory
+  size_t shared_mem_size = 0;
+
   RAJA_INLINE
   Resources() = default;
 
-  Resources(Teams in_teams, Threads in_threads)
-      : teams(in_teams), threads(in_threads){};
+  Resources(Teams in_teams, Threads in_threads, size_t in_shared_mem_size = 0)
+      : teams(in_teams),
+        threads(in_threads),
+        shared_mem_size(in_shared_mem_size){};
 
 private:
   RAJA_HOST_DEVICE
@@ -159,6 +165,13 @@ class LaunchContext : public Resources
 public:
   ExecPlace exec_place;
 
+  //! Team-shared memory of host launches, shared_mem_size bytes
+  void *shared_mem_ptr = nullptr;
+  size_t shared_mem_offset = 0;
+
+  //! Barrier of the host threads of a team, if they run concurrently
+  void (*host_team_sync)() = nullptr;
+
   LaunchContext(Resources const &base, ExecPlace place)
       : Resources(base), exec_place(place)
   {
@@ -170,11 +183,63 @@ public:
   {
 #if defined(RAJA_DEVICE_CODE)
     __syncthreads();
+#else
+    if (host_team_sync) {
+      host_team_sync();
+    }
 #endif
   }
+
+  /*!
+   * Returns memory for count objects of type T that is shared by the
+   * threads of a team, taken from the shared_mem_size bytes requested in
+   * the launch Resources, or nullptr if it does not fit.  Every thread
+   * must make the same calls, e.g. at the top of the launch body, to get
+   * the same memory.  The memory is only available in host launches.
+   */
+  template <typename T>
+  RAJA_HOST_DEVICE T *getSharedMemory(size_t count)
+  {
+    size_t const offset =
+        (shared_mem_offset + alignof(T) - 1) / alignof(T) * alignof(T);
+    if (shared_mem_ptr == nullptr ||
+        offset + count * sizeof(T) > shared_mem_size) {
+      return nullptr;
+    }
+    shared_mem_offset = offset + count * sizeof(T);
+    return reinterpret_cast<T *>(static_cast<char *>(shared_mem_ptr) + offset);
+  }
 };
 
 
+namespace detail
+{
+
+//! Team-shared memory of a host launch
+class HostSharedMemory
+{
+public:
+  explicit HostSharedMemory(size_t bytes)
+      : ptr(bytes ? RAJA::allocate_aligned(RAJA::DATA_ALIGN, bytes) : nullptr)
+  {
+  }
+
+  HostSharedMemory(HostSharedMemory const &) = delete;
+  HostSharedMemory &operator=(HostSharedMemory const &) = delete;
+
+  ~HostSharedMemory()
+  {
+    if (ptr) {
+      RAJA::free_aligned(ptr);
+    }
+  }
+
+  void *ptr;
+};
+
+}  // namespace detail
+
+
 template <typename LAUNCH_POLICY>
 struct LaunchExecute;
 
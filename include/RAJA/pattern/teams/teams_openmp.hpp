@@ -18,6 +18,8 @@
 #ifndef RAJA_pattern_teams_openmp_HPP
 #define RAJA_pattern_teams_openmp_HPP
 
+#include <omp.h>
+
 #include "RAJA/pattern/teams/teams_core.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 
@@ -27,6 +29,145 @@ namespace RAJA
 namespace expt
 {
 
+namespace detail
+{
+
+//! Whether this thread executes the body of an omp_team_launch_t region
+RAJA_INLINE bool &in_omp_team_launch()
+{
+  static thread_local bool in_launch = false;
+  return in_launch;
+}
+
+//! Depth of work-shared loops of an omp_team_launch_t region on this thread
+RAJA_INLINE int &omp_team_launch_worksharing_depth()
+{
+  static thread_local int depth = 0;
+  return depth;
+}
+
+//! Marks the calling thread as inside a work-shared loop
+struct OmpTeamLaunchWorksharing {
+  OmpTeamLaunchWorksharing() { ++omp_team_launch_worksharing_depth(); }
+  ~OmpTeamLaunchWorksharing() { --omp_team_launch_worksharing_depth(); }
+};
+
+/*!
+ * teamSync of omp_team_launch_t.  The threads of the region only form a team
+ * outside of work-shared loops: inside them each iterate runs on a single
+ * thread, e.g. a team of an omp_parallel_for_exec team loop, and there is
+ * nothing to synchronize.
+ */
+RAJA_INLINE void omp_team_launch_sync()
+{
+  if (omp_team_launch_worksharing_depth() == 0) {
+#pragma omp barrier
+  }
+}
+
+/*!
+ * Work-shared loops over the threads of an enclosing parallel region,
+ * followed by a barrier unless NoWait.  Inside another work-shared loop,
+ * where the iterate belongs to one thread, the loops are sequential.
+ */
+template <bool NoWait>
+struct OmpTeamLaunchFor {
+
+  template <typename SEGMENT, typename BODY>
+  static RAJA_INLINE void exec(SEGMENT const &segment, BODY const &body)
+  {
+    const int len = segment.end() - segment.begin();
+    if (omp_team_launch_worksharing_depth() > 0) {
+      for (int i = 0; i < len; i++) {
+        body(*(segment.begin() + i));
+      }
+      return;
+    }
+    {
+      OmpTeamLaunchWorksharing worksharing;
+#pragma omp for nowait
+      for (int i = 0; i < len; i++) {
+
+        body(*(segment.begin() + i));
+      }
+    }
+    if (!NoWait) {
+#pragma omp barrier
+    }
+  }
+
+  template <typename SEGMENT, typename BODY>
+  static RAJA_INLINE void exec(SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+    if (omp_team_launch_worksharing_depth() > 0) {
+      for (int j = 0; j < len1; j++) {
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i), *(segment1.begin() + j));
+        }
+      }
+      return;
+    }
+    {
+      OmpTeamLaunchWorksharing worksharing;
+#pragma omp for RAJA_COLLAPSE(2) nowait
+      for (int j = 0; j < len1; j++) {
+        for (int i = 0; i < len0; i++) {
+
+          body(*(segment0.begin() + i), *(segment1.begin() + j));
+        }
+      }
+    }
+    if (!NoWait) {
+#pragma omp barrier
+    }
+  }
+
+  template <typename SEGMENT, typename BODY>
+  static RAJA_INLINE void exec(SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               SEGMENT const &segment2,
+                               BODY const &body)
+  {
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+    if (omp_team_launch_worksharing_depth() > 0) {
+      for (int k = 0; k < len2; k++) {
+        for (int j = 0; j < len1; j++) {
+          for (int i = 0; i < len0; i++) {
+            body(*(segment0.begin() + i),
+                 *(segment1.begin() + j),
+                 *(segment2.begin() + k));
+          }
+        }
+      }
+      return;
+    }
+    {
+      OmpTeamLaunchWorksharing worksharing;
+#pragma omp for RAJA_COLLAPSE(3) nowait
+      for (int k = 0; k < len2; k++) {
+        for (int j = 0; j < len1; j++) {
+          for (int i = 0; i < len0; i++) {
+            body(*(segment0.begin() + i),
+                 *(segment1.begin() + j),
+                 *(segment2.begin() + k));
+          }
+        }
+      }
+    }
+    if (!NoWait) {
+#pragma omp barrier
+    }
+  }
+};
+
+}  // namespace detail
+
 struct omp_launch_t {
 };
 
@@ -35,7 +176,67 @@ struct LaunchExecute<RAJA::expt::omp_launch_t> {
   template <typename BODY>
   static void exec(LaunchContext const &ctx, BODY const &body)
   {
-    body(ctx);
+    detail::HostSharedMemory shared_mem(ctx.shared_mem_size);
+
+    LaunchContext team_ctx(ctx);
+    team_ctx.shared_mem_ptr = shared_mem.ptr;
+
+    body(team_ctx);
+  }
+};
+
+/*!
+ * Launches one OpenMP parallel region of up to Teams (x*y*z) times Threads
+ * (x*y*z) threads, capped at omp_get_max_threads(), in which every thread
+ * executes the launch body, like the threads of a GPU block.  Unlike
+ * omp_launch_t, which runs the body once and opens a parallel region per
+ * omp_parallel_for_exec loop, code of the body outside of work-shared
+ * loops, including loop_exec loops, runs once per thread.  Teams may be
+ * mapped onto the threads in two ways:
+ *
+ *  - team loops with omp_parallel_for_exec are shared out over the threads,
+ *    so each team runs on a single thread with sequential thread loops;
+ *    RAJA_TEAM_SHARED arrays are team-shared and teamSync() does nothing.
+ *
+ *  - team loops with loop_exec are executed by all threads together and
+ *    thread loops with omp_for_exec or omp_for_nowait_exec are shared out
+ *    over them; teamSync() is a barrier.  RAJA_TEAM_SHARED arrays are
+ *    private to each thread here, and ctx.getSharedMemory gives the memory
+ *    shared by the team.
+ */
+struct omp_team_launch_t {
+};
+
+template <>
+struct LaunchExecute<RAJA::expt::omp_team_launch_t> {
+  template <typename BODY>
+  static void exec(LaunchContext const &ctx, BODY const &body)
+  {
+    detail::HostSharedMemory shared_mem(ctx.shared_mem_size);
+
+    LaunchContext team_ctx(ctx);
+    team_ctx.shared_mem_ptr = shared_mem.ptr;
+    team_ctx.host_team_sync = &detail::omp_team_launch_sync;
+
+    // every team and thread of the launch, up to the OpenMP thread pool
+    long long num_threads = 1;
+    for (int d = 0; d < 3; ++d) {
+      num_threads *= ctx.teams.value[d] > 0 ? ctx.teams.value[d] : 1;
+      num_threads *= ctx.threads.value[d] > 0 ? ctx.threads.value[d] : 1;
+      if (num_threads > omp_get_max_threads()) {
+        num_threads = omp_get_max_threads();
+      }
+    }
+
+#pragma omp parallel num_threads(static_cast<int>(num_threads))
+    {
+      LaunchContext thread_ctx(team_ctx);
+
+      bool const was_in_launch = detail::in_omp_team_launch();
+      detail::in_omp_team_launch() = true;
+      body(thread_ctx);
+      detail::in_omp_team_launch() = was_in_launch;
+    }
   }
 };
 
@@ -49,6 +250,10 @@ struct LoopExecute<omp_parallel_for_exec, SEGMENT> {
       SEGMENT const &segment,
       BODY const &body)
   {
+    if (detail::in_omp_team_launch()) {
+      detail::OmpTeamLaunchFor<false>::exec(segment, body);
+      return;
+    }
 
     int len = segment.end() - segment.begin();
 #pragma omp parallel for
@@ -65,6 +270,10 @@ struct LoopExecute<omp_parallel_for_exec, SEGMENT> {
       SEGMENT const &segment1,
       BODY const &body)
   {
+    if (detail::in_omp_team_launch()) {
+      detail::OmpTeamLaunchFor<false>::exec(segment0, segment1, body);
+      return;
+    }
 
     const int len1 = segment1.end() - segment1.begin();
     const int len0 = segment0.end() - segment0.begin();
@@ -86,6 +295,10 @@ struct LoopExecute<omp_parallel_for_exec, SEGMENT> {
       SEGMENT const &segment2,
       BODY const &body)
   {
+    if (detail::in_omp_team_launch()) {
+      detail::OmpTeamLaunchFor<false>::exec(segment0, segment1, segment2, body);
+      return;
+    }
 
     const int len2 = segment2.end() - segment2.begin();
     const int len1 = segment1.end() - segment1.begin();
@@ -104,6 +317,29 @@ struct LoopExecute<omp_parallel_for_exec, SEGMENT> {
   }
 };
 
+// work-shared loops over the threads of an omp_team_launch_t region
+template <typename SEGMENT>
+struct LoopExecute<omp_for_exec, SEGMENT> {
+
+  template <typename... Args>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               Args const &... args)
+  {
+    detail::OmpTeamLaunchFor<false>::exec(args...);
+  }
+};
+
+template <typename SEGMENT>
+struct LoopExecute<omp_for_nowait_exec, SEGMENT> {
+
+  template <typename... Args>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               Args const &... args)
+  {
+    detail::OmpTeamLaunchFor<true>::exec(args...);
+  }
+};
+
 // policy for perfectly nested loops
 struct omp_parallel_nested_for_exec;
 
@@ -117,6 +353,10 @@ struct LoopExecute<omp_parallel_nested_for_exec, SEGMENT> {
       SEGMENT const &segment1,
       BODY const &body)
   {
+    if (detail::in_omp_team_launch()) {
+      detail::OmpTeamLaunchFor<false>::exec(segment0, segment1, body);
+      return;
+    }
 
     const int len1 = segment1.end() - segment1.begin();
     const int len0 = segment0.end() - segment0.begin();
@@ -138,6 +378,10 @@ struct LoopExecute<omp_parallel_nested_for_exec, SEGMENT> {
       SEGMENT const &segment2,
       BODY const &body)
   {
+    if (detail::in_omp_team_launch()) {
+      detail::OmpTeamLaunchFor<false>::exec(segment0, segment1, segment2, body);
+      return;
+    }
 
     const int len2 = segment2.end() - segment2.begin();
     const int len1 = segment1.end() - segment1.begin();
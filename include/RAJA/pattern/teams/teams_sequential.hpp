@@ -48,7 +48,12 @@ struct LaunchExecute<RAJA::expt::seq_launch_t> {
   template <typename BODY>
   static void exec(LaunchContext const &ctx, BODY const &body)
   {
-    body(ctx);
+    detail::HostSharedMemory shared_mem(ctx.shared_mem_size);
+
+    LaunchContext team_ctx(ctx);
+    team_ctx.shared_mem_ptr = shared_mem.ptr;
+
+    body(team_ctx);
   }
 };
 
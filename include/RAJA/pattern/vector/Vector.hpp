@@ -0,0 +1,241 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining explicit SIMD vector types.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_vector_Vector_HPP
+#define RAJA_pattern_vector_Vector_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/vector/internal/register_scalar.hpp"
+#include "RAJA/pattern/vector/internal/register_sse.hpp"
+#include "RAJA/pattern/vector/internal/register_avx.hpp"
+#include "RAJA/pattern/vector/internal/register_avx512.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * @brief A vector of Width values of type T held in a SIMD register.
+ *
+ * Arithmetic on a Vector maps directly onto vector instructions when the
+ * target has a native register of that element type and width (SSE2, AVX or
+ * AVX-512), and onto RAJA_SIMD loops otherwise.  Loads and stores take an
+ * optional lane count, lanes at and beyond which are not accessed; this is
+ * how vector_exec handles the remainder of a loop.
+ *
+ *   Vector<double, 4> a = Vector<double, 4>::load(x + i);
+ *   (a * 2.0 + 1.0).store(y + i);
+ */
+template <typename T, camp::idx_t Width>
+class Vector
+{
+  static_assert(Width > 0, "Vector width must be positive");
+
+public:
+  using element_type = T;
+  using register_policy = internal::VectorRegister<T, Width>;
+  using register_type = typename register_policy::register_type;
+
+  static constexpr camp::idx_t width = Width;
+
+  Vector() = default;
+
+  //! Broadcast a scalar to all lanes
+  RAJA_INLINE Vector(element_type a) : m_value(register_policy::broadcast(a))
+  {
+  }
+
+  RAJA_INLINE explicit Vector(register_type const &r) : m_value(r) {}
+
+  //! Load the first n lanes from contiguous memory, zeroing the rest
+  static RAJA_INLINE Vector load(element_type const *ptr,
+                                 camp::idx_t n = Width)
+  {
+    return Vector(n == Width ? register_policy::load(ptr)
+                             : register_policy::load_n(ptr, n));
+  }
+
+  //! Load the first n lanes from memory with the given element stride
+  static RAJA_INLINE Vector load_strided(element_type const *ptr,
+                                         Index_type stride,
+                                         camp::idx_t n = Width)
+  {
+    Vector r(element_type(0));
+    for (camp::idx_t i = 0; i < n; ++i) {
+      r.set(i, ptr[i * stride]);
+    }
+    return r;
+  }
+
+  //! Load the first n lanes from ptr[offsets[i]], zeroing the rest
+  static RAJA_INLINE Vector load_gather(element_type const *ptr,
+                                        Index_type const *offsets,
+                                        camp::idx_t n = Width)
+  {
+    Vector r(element_type(0));
+    for (camp::idx_t i = 0; i < n; ++i) {
+      r.set(i, ptr[offsets[i]]);
+    }
+    return r;
+  }
+
+  //! Store the first n lanes to contiguous memory
+  RAJA_INLINE void store(element_type *ptr, camp::idx_t n = Width) const
+  {
+    if (n == Width) {
+      register_policy::store(ptr, m_value);
+    } else {
+      register_policy::store_n(ptr, m_value, n);
+    }
+  }
+
+  //! Store the first n lanes to memory with the given element stride
+  RAJA_INLINE void store_strided(element_type *ptr,
+                                 Index_type stride,
+                                 camp::idx_t n = Width) const
+  {
+    for (camp::idx_t i = 0; i < n; ++i) {
+      ptr[i * stride] = (*this)[i];
+    }
+  }
+
+  //! Store the first n lanes to ptr[offsets[i]]
+  RAJA_INLINE void store_scatter(element_type *ptr,
+                                 Index_type const *offsets,
+                                 camp::idx_t n = Width) const
+  {
+    for (camp::idx_t i = 0; i < n; ++i) {
+      ptr[offsets[i]] = (*this)[i];
+    }
+  }
+
+  RAJA_INLINE element_type operator[](camp::idx_t i) const
+  {
+    return register_policy::get(m_value, i);
+  }
+
+  RAJA_INLINE void set(camp::idx_t i, element_type a)
+  {
+    m_value = register_policy::set(m_value, i, a);
+  }
+
+  RAJA_INLINE register_type const &get_register() const { return m_value; }
+
+  //! Sum of all lanes
+  RAJA_INLINE element_type sum() const { return register_policy::sum(m_value); }
+
+  friend RAJA_INLINE Vector operator+(Vector const &a, Vector const &b)
+  {
+    return Vector(register_policy::add(a.m_value, b.m_value));
+  }
+
+  friend RAJA_INLINE Vector operator-(Vector const &a, Vector const &b)
+  {
+    return Vector(register_policy::subtract(a.m_value, b.m_value));
+  }
+
+  friend RAJA_INLINE Vector operator*(Vector const &a, Vector const &b)
+  {
+    return Vector(register_policy::multiply(a.m_value, b.m_value));
+  }
+
+  friend RAJA_INLINE Vector operator/(Vector const &a, Vector const &b)
+  {
+    return Vector(register_policy::divide(a.m_value, b.m_value));
+  }
+
+  friend RAJA_INLINE Vector operator-(Vector const &a)
+  {
+    return Vector(element_type(0)) - a;
+  }
+
+  //! a * b + c, fused where the target supports it
+  friend RAJA_INLINE Vector fma(Vector const &a,
+                                Vector const &b,
+                                Vector const &c)
+  {
+    return Vector(register_policy::fma(a.m_value, b.m_value, c.m_value));
+  }
+
+  friend RAJA_INLINE Vector min(Vector const &a, Vector const &b)
+  {
+    return Vector(register_policy::min(a.m_value, b.m_value));
+  }
+
+  friend RAJA_INLINE Vector max(Vector const &a, Vector const &b)
+  {
+    return Vector(register_policy::max(a.m_value, b.m_value));
+  }
+
+  RAJA_INLINE Vector &operator+=(Vector const &b) { return *this = *this + b; }
+
+  RAJA_INLINE Vector &operator-=(Vector const &b) { return *this = *this - b; }
+
+  RAJA_INLINE Vector &operator*=(Vector const &b) { return *this = *this * b; }
+
+  RAJA_INLINE Vector &operator/=(Vector const &b) { return *this = *this / b; }
+
+private:
+  register_type m_value;
+};
+
+template <typename T, camp::idx_t Width>
+constexpr camp::idx_t Vector<T, Width>::width;
+
+
+/*!
+ * @brief Width of the widest native register of T enabled for this target,
+ * or 1 if there is none.
+ */
+template <typename T>
+struct native_vector_width
+    : std::integral_constant<camp::idx_t,
+                             internal::VectorRegister<T, 64 / sizeof(T)>::
+                                     is_native
+                                 ? 64 / sizeof(T)
+                                 : internal::VectorRegister<T, 32 / sizeof(T)>::
+                                           is_native
+                                       ? 32 / sizeof(T)
+                                       : internal::VectorRegister<
+                                             T,
+                                             16 / sizeof(T)>::is_native
+                                             ? 16 / sizeof(T)
+                                             : 1> {
+};
+
+//! Vector of T using the widest native register
+template <typename T>
+using NativeVector = Vector<T, native_vector_width<T>::value>;
+
+template <typename T>
+struct is_vector : std::false_type {
+};
+
+template <typename T, camp::idx_t Width>
+struct is_vector<Vector<T, Width>> : std::true_type {
+};
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,458 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining vector loop indices and the View
+ *          element references they produce.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_vector_VectorIndex_HPP
+#define RAJA_pattern_vector_VectorIndex_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/vector/Vector.hpp"
+
+namespace RAJA
+{
+
+struct VectorIndexBase {
+};
+
+/*!
+ * @brief Index of the first of size() consecutive loop iterations that are
+ * executed together as one VectorType.
+ *
+ * This is the loop variable of vector_exec loops.  Indexing a View with a
+ * VectorIndex gives a VectorRef, which loads and stores size() elements at
+ * once.  Converting from IdxT gives a full-width index, so kernel lambdas
+ * can take a VectorIndex argument directly.
+ */
+template <typename IdxT, typename VectorType>
+struct VectorIndex : public VectorIndexBase {
+  using index_type = IdxT;
+  using vector_type = VectorType;
+
+  IdxT index;
+  camp::idx_t length;
+
+  RAJA_INLINE constexpr VectorIndex() : index(), length(0) {}
+
+  RAJA_INLINE constexpr VectorIndex(IdxT i, camp::idx_t len = VectorType::width)
+      : index(i), length(len)
+  {
+  }
+
+  //! The first index
+  RAJA_INLINE constexpr IdxT value() const { return index; }
+
+  RAJA_INLINE constexpr IdxT operator*() const { return index; }
+
+  //! Number of active lanes
+  RAJA_INLINE constexpr camp::idx_t size() const { return length; }
+
+  //! Shift the indices of all lanes, e.g. for stencil neighbors
+  template <typename T>
+  RAJA_INLINE constexpr VectorIndex operator+(T b) const
+  {
+    return VectorIndex(IdxT(stripIndexType(index) + b), length);
+  }
+
+  template <typename T>
+  RAJA_INLINE constexpr VectorIndex operator-(T b) const
+  {
+    return VectorIndex(IdxT(stripIndexType(index) - b), length);
+  }
+};
+
+namespace detail
+{
+
+/*!
+ * A VectorIndex whose lane count N is fixed by its type, for the remainder of
+ * a kernel loop where the index is built from the bare IdxT.
+ */
+template <typename IdxT, typename VectorType, camp::idx_t N>
+struct VectorTailIndex : public VectorIndex<IdxT, VectorType> {
+  RAJA_INLINE constexpr VectorTailIndex(IdxT i)
+      : VectorIndex<IdxT, VectorType>(i, N)
+  {
+  }
+};
+
+template <typename T>
+struct is_vector_index
+    : std::is_base_of<VectorIndexBase, camp::decay<T>> {
+};
+
+template <typename... Args>
+struct count_vector_index;
+
+template <>
+struct count_vector_index<> : std::integral_constant<int, 0> {
+};
+
+template <typename Arg, typename... Args>
+struct count_vector_index<Arg, Args...>
+    : std::integral_constant<int,
+                             int(is_vector_index<Arg>::value) +
+                                 count_vector_index<Args...>::value> {
+};
+
+template <typename... Args>
+struct any_vector_index
+    : std::integral_constant<bool, (count_vector_index<Args...>::value > 0)> {
+};
+
+// VectorIndex arguments contribute their first index, others are stripped
+
+template <typename T>
+RAJA_INLINE constexpr auto vector_index_first(T const &i) ->
+    typename std::enable_if<!is_vector_index<T>::value,
+                            decltype(stripIndexType(i))>::type
+{
+  return stripIndexType(i);
+}
+
+template <typename T>
+RAJA_INLINE constexpr auto vector_index_first(T const &i) ->
+    typename std::enable_if<is_vector_index<T>::value,
+                            decltype(stripIndexType(i.index))>::type
+{
+  return stripIndexType(i.index);
+}
+
+// as above, but with VectorIndex arguments advanced to their second lane
+
+template <typename T>
+RAJA_INLINE constexpr auto vector_index_next(T const &i) ->
+    typename std::enable_if<!is_vector_index<T>::value,
+                            decltype(stripIndexType(i))>::type
+{
+  return stripIndexType(i);
+}
+
+template <typename T>
+RAJA_INLINE constexpr auto vector_index_next(T const &i) ->
+    typename std::enable_if<is_vector_index<T>::value,
+                            decltype(stripIndexType(i.index))>::type
+{
+  return stripIndexType(i.index) + 1;
+}
+
+// as above, but with VectorIndex arguments advanced to lane l
+
+template <typename T>
+RAJA_INLINE constexpr auto vector_index_lane(T const &i, camp::idx_t) ->
+    typename std::enable_if<!is_vector_index<T>::value,
+                            decltype(stripIndexType(i))>::type
+{
+  return stripIndexType(i);
+}
+
+template <typename T>
+RAJA_INLINE constexpr auto vector_index_lane(T const &i, camp::idx_t l) ->
+    typename std::enable_if<is_vector_index<T>::value,
+                            decltype(stripIndexType(i.index))>::type
+{
+  return stripIndexType(i.index) + l;
+}
+
+template <typename T>
+RAJA_INLINE constexpr
+    typename std::enable_if<!is_vector_index<T>::value, camp::idx_t>::type
+    vector_index_length(T const &)
+{
+  return 0;
+}
+
+template <typename T>
+RAJA_INLINE constexpr
+    typename std::enable_if<is_vector_index<T>::value, camp::idx_t>::type
+    vector_index_length(T const &i)
+{
+  return i.length;
+}
+
+template <typename T, bool = is_vector_index<T>::value>
+struct vector_index_type {
+  using type = void;
+};
+
+template <typename T>
+struct vector_index_type<T, true> {
+  using type = typename camp::decay<T>::vector_type;
+};
+
+template <typename... Args>
+struct vector_type_of;
+
+template <typename Arg, typename... Args>
+struct vector_type_of<Arg, Args...> {
+  using type = typename std::conditional<
+      is_vector_index<Arg>::value,
+      typename vector_index_type<Arg>::type,
+      typename vector_type_of<Args...>::type>::type;
+};
+
+template <>
+struct vector_type_of<> {
+  using type = void;
+};
+
+//! Lanes of a VectorRef that are stride elements apart
+struct StridedLanes {
+  Index_type stride;
+
+  template <typename VectorType, typename T>
+  RAJA_INLINE VectorType load(T const *ptr, camp::idx_t length) const
+  {
+    return stride == 1 ? VectorType::load(ptr, length)
+                       : VectorType::load_strided(ptr, stride, length);
+  }
+
+  template <typename VectorType, typename T>
+  RAJA_INLINE void store(VectorType const &v, T *ptr, camp::idx_t length) const
+  {
+    if (stride == 1) {
+      v.store(ptr, length);
+    } else {
+      v.store_strided(ptr, stride, length);
+    }
+  }
+};
+
+//! Lanes of a VectorRef at arbitrary offsets, gathered and scattered
+template <camp::idx_t Width>
+struct GatherLanes {
+  Index_type offsets[Width];
+
+  template <typename VectorType, typename T>
+  RAJA_INLINE VectorType load(T const *ptr, camp::idx_t length) const
+  {
+    return VectorType::load_gather(ptr, offsets, length);
+  }
+
+  template <typename VectorType, typename T>
+  RAJA_INLINE void store(VectorType const &v, T *ptr, camp::idx_t length) const
+  {
+    v.store_scatter(ptr, offsets, length);
+  }
+};
+
+}  // namespace detail
+
+/*!
+ * Whether the linear index of a layout is affine in each index, so the
+ * lanes of a VectorIndex are equally spaced in memory.  Layouts that are
+ * not, such as MortonLayout and HilbertLayout, specialize this to false;
+ * Views with them gather and scatter the lanes of a VectorIndex.
+ */
+template <typename LayoutType>
+struct is_affine_layout : std::true_type {
+};
+
+
+/*!
+ * @brief Reference to the elements of a View selected by a VectorIndex.
+ *
+ * Reads load the active lanes into a VectorType, zeroing the others; writes
+ * store only the active lanes.  With StridedLanes consecutive lanes are
+ * stride elements apart in memory, and unit stride uses contiguous loads and
+ * stores; with GatherLanes each lane has its own offset from ptr.
+ */
+template <typename VectorType,
+          typename ValueType,
+          typename Lanes = detail::StridedLanes>
+struct VectorRef {
+  using vector_type = VectorType;
+  using value_type = ValueType;
+  using lanes_type = Lanes;
+
+  static_assert(std::is_same<camp::decay<ValueType>,
+                             typename VectorType::element_type>::value,
+                "VectorRef value type must match the vector element type");
+
+  ValueType *ptr;
+  Lanes lanes;
+  camp::idx_t length;
+
+  RAJA_INLINE vector_type load() const
+  {
+    return lanes.template load<vector_type>(ptr, length);
+  }
+
+  RAJA_INLINE void store(vector_type const &v) const
+  {
+    lanes.store(v, ptr, length);
+  }
+
+  RAJA_INLINE operator vector_type() const { return load(); }
+
+  RAJA_INLINE VectorRef const &operator=(vector_type const &v) const
+  {
+    store(v);
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef const &operator=(
+      typename vector_type::element_type a) const
+  {
+    store(vector_type(a));
+    return *this;
+  }
+
+  // assigning from another reference copies the elements
+  RAJA_INLINE VectorRef const &operator=(VectorRef const &rhs) const
+  {
+    store(rhs.load());
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef const &operator+=(vector_type const &v) const
+  {
+    store(load() + v);
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef const &operator-=(vector_type const &v) const
+  {
+    store(load() - v);
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef const &operator*=(vector_type const &v) const
+  {
+    store(load() * v);
+    return *this;
+  }
+
+  RAJA_INLINE VectorRef const &operator/=(vector_type const &v) const
+  {
+    store(load() / v);
+    return *this;
+  }
+};
+
+namespace detail
+{
+
+template <bool HasVectorIndex,
+          typename LayoutType,
+          typename ValueType,
+          typename... Args>
+struct vector_ref_impl {
+};
+
+template <typename LayoutType, typename ValueType, typename... Args>
+struct vector_ref_impl<true, LayoutType, ValueType, Args...> {
+  using vector_type = typename vector_type_of<Args...>::type;
+  using lanes_type =
+      typename std::conditional<is_affine_layout<LayoutType>::value,
+                                StridedLanes,
+                                GatherLanes<vector_type::width>>::type;
+  using type = VectorRef<vector_type, ValueType, lanes_type>;
+};
+
+//! The VectorRef type of a View with layout LayoutType indexed by Args, if
+//! one of Args is a VectorIndex
+template <typename LayoutType, typename ValueType, typename... Args>
+struct vector_ref : vector_ref_impl<any_vector_index<Args...>::value,
+                                    LayoutType,
+                                    ValueType,
+                                    Args...> {
+};
+
+template <typename LayoutType, typename ValueType, typename... Args>
+RAJA_INLINE VectorRef<typename vector_type_of<Args...>::type,
+                      ValueType,
+                      StridedLanes>
+make_vector_ref(StridedLanes,
+                LayoutType const &layout,
+                ValueType *data,
+                camp::idx_t length,
+                Args const &... args)
+{
+  Index_type const lin0 = stripIndexType(layout(vector_index_first(args)...));
+
+  // only ask the layout for the second lane if it exists, so the bounds
+  // checks stay valid
+  Index_type const stride =
+      length > 1 ? stripIndexType(layout(vector_index_next(args)...)) - lin0
+                 : 1;
+
+  return {data + lin0, {stride}, length};
+}
+
+template <typename LayoutType,
+          typename ValueType,
+          camp::idx_t Width,
+          typename... Args>
+RAJA_INLINE VectorRef<typename vector_type_of<Args...>::type,
+                      ValueType,
+                      GatherLanes<Width>>
+make_vector_ref(GatherLanes<Width>,
+                LayoutType const &layout,
+                ValueType *data,
+                camp::idx_t length,
+                Args const &... args)
+{
+  VectorRef<typename vector_type_of<Args...>::type,
+            ValueType,
+            GatherLanes<Width>>
+      ref{data, {}, length};
+  for (camp::idx_t l = 0; l < length; ++l) {
+    ref.lanes.offsets[l] =
+        stripIndexType(layout(vector_index_lane(args, l)...));
+  }
+  return ref;
+}
+
+}  // namespace detail
+
+/*!
+ * Returns the VectorRef for layout(args...) into data, where exactly one of
+ * args is a VectorIndex.  Lanes are equally spaced for affine layouts, and
+ * are gathered and scattered through the layout otherwise.
+ */
+template <typename LayoutType, typename ValueType, typename... Args>
+RAJA_INLINE typename detail::vector_ref<LayoutType, ValueType, Args...>::type
+make_vector_ref(LayoutType const &layout, ValueType *data, Args const &... args)
+{
+  static_assert(detail::count_vector_index<Args...>::value == 1,
+                "Exactly one View index may be a VectorIndex");
+
+  using ref_type =
+      typename detail::vector_ref<LayoutType, ValueType, Args...>::type;
+
+  camp::idx_t const length =
+      RAJA::sum<camp::idx_t>(detail::vector_index_length(args)...);
+
+  return detail::make_vector_ref(
+      typename ref_type::lanes_type{}, layout, data, length, args...);
+}
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,246 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   AVX vector registers: 4 doubles and 8 floats.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_vector_internal_register_avx_HPP
+#define RAJA_pattern_vector_internal_register_avx_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(__AVX__)
+
+#include <immintrin.h>
+
+#include "RAJA/pattern/vector/internal/register_scalar.hpp"
+
+namespace RAJA
+{
+namespace internal
+{
+
+template <>
+struct VectorRegister<double, 4> {
+  using register_type = __m256d;
+
+  static constexpr bool is_native = true;
+
+  // lanes [0, n) set, used for masked loads and stores
+  static RAJA_INLINE __m256i mask(camp::idx_t n)
+  {
+    return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_set_pd(3.0, 2.0, 1.0, 0.0),
+                                             _mm256_set1_pd(double(n)),
+                                             _CMP_LT_OQ));
+  }
+
+  static RAJA_INLINE register_type broadcast(double a)
+  {
+    return _mm256_set1_pd(a);
+  }
+
+  static RAJA_INLINE register_type load(double const *ptr)
+  {
+    return _mm256_loadu_pd(ptr);
+  }
+
+  static RAJA_INLINE register_type load_n(double const *ptr, camp::idx_t n)
+  {
+    return _mm256_maskload_pd(ptr, mask(n));
+  }
+
+  static RAJA_INLINE void store(double *ptr, register_type a)
+  {
+    _mm256_storeu_pd(ptr, a);
+  }
+
+  static RAJA_INLINE void store_n(double *ptr, register_type a, camp::idx_t n)
+  {
+    _mm256_maskstore_pd(ptr, mask(n), a);
+  }
+
+  static RAJA_INLINE double get(register_type a, camp::idx_t i)
+  {
+    alignas(32) double v[4];
+    _mm256_store_pd(v, a);
+    return v[i];
+  }
+
+  static RAJA_INLINE register_type set(register_type a, camp::idx_t i, double b)
+  {
+    alignas(32) double v[4];
+    _mm256_store_pd(v, a);
+    v[i] = b;
+    return _mm256_load_pd(v);
+  }
+
+  static RAJA_INLINE register_type add(register_type a, register_type b)
+  {
+    return _mm256_add_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type subtract(register_type a, register_type b)
+  {
+    return _mm256_sub_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type multiply(register_type a, register_type b)
+  {
+    return _mm256_mul_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type divide(register_type a, register_type b)
+  {
+    return _mm256_div_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type min(register_type a, register_type b)
+  {
+    return _mm256_min_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type max(register_type a, register_type b)
+  {
+    return _mm256_max_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type fma(register_type a,
+                                       register_type b,
+                                       register_type c)
+  {
+#if defined(__FMA__)
+    return _mm256_fmadd_pd(a, b, c);
+#else
+    return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+  }
+
+  static RAJA_INLINE double sum(register_type a)
+  {
+    __m128d s = _mm_add_pd(_mm256_castpd256_pd128(a),
+                           _mm256_extractf128_pd(a, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+  }
+};
+
+template <>
+struct VectorRegister<float, 8> {
+  using register_type = __m256;
+
+  static constexpr bool is_native = true;
+
+  static RAJA_INLINE __m256i mask(camp::idx_t n)
+  {
+    return _mm256_castps_si256(
+        _mm256_cmp_ps(_mm256_set_ps(7.f, 6.f, 5.f, 4.f, 3.f, 2.f, 1.f, 0.f),
+                      _mm256_set1_ps(float(n)),
+                      _CMP_LT_OQ));
+  }
+
+  static RAJA_INLINE register_type broadcast(float a)
+  {
+    return _mm256_set1_ps(a);
+  }
+
+  static RAJA_INLINE register_type load(float const *ptr)
+  {
+    return _mm256_loadu_ps(ptr);
+  }
+
+  static RAJA_INLINE register_type load_n(float const *ptr, camp::idx_t n)
+  {
+    return _mm256_maskload_ps(ptr, mask(n));
+  }
+
+  static RAJA_INLINE void store(float *ptr, register_type a)
+  {
+    _mm256_storeu_ps(ptr, a);
+  }
+
+  static RAJA_INLINE void store_n(float *ptr, register_type a, camp::idx_t n)
+  {
+    _mm256_maskstore_ps(ptr, mask(n), a);
+  }
+
+  static RAJA_INLINE float get(register_type a, camp::idx_t i)
+  {
+    alignas(32) float v[8];
+    _mm256_store_ps(v, a);
+    return v[i];
+  }
+
+  static RAJA_INLINE register_type set(register_type a, camp::idx_t i, float b)
+  {
+    alignas(32) float v[8];
+    _mm256_store_ps(v, a);
+    v[i] = b;
+    return _mm256_load_ps(v);
+  }
+
+  static RAJA_INLINE register_type add(register_type a, register_type b)
+  {
+    return _mm256_add_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type subtract(register_type a, register_type b)
+  {
+    return _mm256_sub_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type multiply(register_type a, register_type b)
+  {
+    return _mm256_mul_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type divide(register_type a, register_type b)
+  {
+    return _mm256_div_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type min(register_type a, register_type b)
+  {
+    return _mm256_min_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type max(register_type a, register_type b)
+  {
+    return _mm256_max_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type fma(register_type a,
+                                       register_type b,
+                                       register_type c)
+  {
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+  }
+
+  static RAJA_INLINE float sum(register_type a)
+  {
+    __m128 s =
+        _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+  }
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // __AVX__
+
+#endif
@@ -0,0 +1,225 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   AVX-512 vector registers: 8 doubles and 16 floats.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_vector_internal_register_avx512_HPP
+#define RAJA_pattern_vector_internal_register_avx512_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(__AVX512F__)
+
+#include <immintrin.h>
+
+#include "RAJA/pattern/vector/internal/register_scalar.hpp"
+
+namespace RAJA
+{
+namespace internal
+{
+
+template <>
+struct VectorRegister<double, 8> {
+  using register_type = __m512d;
+
+  static constexpr bool is_native = true;
+
+  static RAJA_INLINE __mmask8 mask(camp::idx_t n)
+  {
+    return static_cast<__mmask8>((1u << n) - 1u);
+  }
+
+  static RAJA_INLINE register_type broadcast(double a)
+  {
+    return _mm512_set1_pd(a);
+  }
+
+  static RAJA_INLINE register_type load(double const *ptr)
+  {
+    return _mm512_loadu_pd(ptr);
+  }
+
+  static RAJA_INLINE register_type load_n(double const *ptr, camp::idx_t n)
+  {
+    return _mm512_maskz_loadu_pd(mask(n), ptr);
+  }
+
+  static RAJA_INLINE void store(double *ptr, register_type a)
+  {
+    _mm512_storeu_pd(ptr, a);
+  }
+
+  static RAJA_INLINE void store_n(double *ptr, register_type a, camp::idx_t n)
+  {
+    _mm512_mask_storeu_pd(ptr, mask(n), a);
+  }
+
+  static RAJA_INLINE double get(register_type a, camp::idx_t i)
+  {
+    alignas(64) double v[8];
+    _mm512_store_pd(v, a);
+    return v[i];
+  }
+
+  static RAJA_INLINE register_type set(register_type a, camp::idx_t i, double b)
+  {
+    return _mm512_mask_mov_pd(a,
+                              static_cast<__mmask8>(1u << i),
+                              _mm512_set1_pd(b));
+  }
+
+  static RAJA_INLINE register_type add(register_type a, register_type b)
+  {
+    return _mm512_add_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type subtract(register_type a, register_type b)
+  {
+    return _mm512_sub_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type multiply(register_type a, register_type b)
+  {
+    return _mm512_mul_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type divide(register_type a, register_type b)
+  {
+    return _mm512_div_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type min(register_type a, register_type b)
+  {
+    return _mm512_min_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type max(register_type a, register_type b)
+  {
+    return _mm512_max_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type fma(register_type a,
+                                       register_type b,
+                                       register_type c)
+  {
+    return _mm512_fmadd_pd(a, b, c);
+  }
+
+  static RAJA_INLINE double sum(register_type a)
+  {
+    return _mm512_reduce_add_pd(a);
+  }
+};
+
+template <>
+struct VectorRegister<float, 16> {
+  using register_type = __m512;
+
+  static constexpr bool is_native = true;
+
+  static RAJA_INLINE __mmask16 mask(camp::idx_t n)
+  {
+    return static_cast<__mmask16>((1u << n) - 1u);
+  }
+
+  static RAJA_INLINE register_type broadcast(float a)
+  {
+    return _mm512_set1_ps(a);
+  }
+
+  static RAJA_INLINE register_type load(float const *ptr)
+  {
+    return _mm512_loadu_ps(ptr);
+  }
+
+  static RAJA_INLINE register_type load_n(float const *ptr, camp::idx_t n)
+  {
+    return _mm512_maskz_loadu_ps(mask(n), ptr);
+  }
+
+  static RAJA_INLINE void store(float *ptr, register_type a)
+  {
+    _mm512_storeu_ps(ptr, a);
+  }
+
+  static RAJA_INLINE void store_n(float *ptr, register_type a, camp::idx_t n)
+  {
+    _mm512_mask_storeu_ps(ptr, mask(n), a);
+  }
+
+  static RAJA_INLINE float get(register_type a, camp::idx_t i)
+  {
+    alignas(64) float v[16];
+    _mm512_store_ps(v, a);
+    return v[i];
+  }
+
+  static RAJA_INLINE register_type set(register_type a, camp::idx_t i, float b)
+  {
+    return _mm512_mask_mov_ps(a,
+                              static_cast<__mmask16>(1u << i),
+                              _mm512_set1_ps(b));
+  }
+
+  static RAJA_INLINE register_type add(register_type a, register_type b)
+  {
+    return _mm512_add_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type subtract(register_type a, register_type b)
+  {
+    return _mm512_sub_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type multiply(register_type a, register_type b)
+  {
+    return _mm512_mul_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type divide(register_type a, register_type b)
+  {
+    return _mm512_div_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type min(register_type a, register_type b)
+  {
+    return _mm512_min_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type max(register_type a, register_type b)
+  {
+    return _mm512_max_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type fma(register_type a,
+                                       register_type b,
+                                       register_type c)
+  {
+    return _mm512_fmadd_ps(a, b, c);
+  }
+
+  static RAJA_INLINE float sum(register_type a)
+  {
+    return _mm512_reduce_add_ps(a);
+  }
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // __AVX512F__
+
+#endif
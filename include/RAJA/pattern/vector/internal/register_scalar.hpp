@@ -0,0 +1,152 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Generic vector register, an array of lanes operated on with
+ *          RAJA_SIMD loops.  Used for widths with no native register.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_vector_internal_register_scalar_HPP
+#define RAJA_pattern_vector_internal_register_scalar_HPP
+
+#include "RAJA/config.hpp"
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace internal
+{
+
+/*!
+ * @brief Register operations for a vector of Width lanes of type T.
+ *
+ * This generic version stores the lanes in an array; ISA-specific headers
+ * specialize it for the widths of native registers.  Partial loads zero the
+ * lanes at and beyond n, partial stores leave that memory untouched.
+ */
+template <typename T, camp::idx_t Width>
+struct VectorRegister {
+  struct register_type {
+    T v[Width];
+  };
+
+  static constexpr bool is_native = false;
+
+  static RAJA_INLINE register_type broadcast(T a)
+  {
+    register_type r;
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      r.v[i] = a;
+    }
+    return r;
+  }
+
+  static RAJA_INLINE register_type load(T const *ptr)
+  {
+    register_type r;
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      r.v[i] = ptr[i];
+    }
+    return r;
+  }
+
+  static RAJA_INLINE register_type load_n(T const *ptr, camp::idx_t n)
+  {
+    register_type r;
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      r.v[i] = i < n ? ptr[i] : T(0);
+    }
+    return r;
+  }
+
+  static RAJA_INLINE void store(T *ptr, register_type const &a)
+  {
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      ptr[i] = a.v[i];
+    }
+  }
+
+  static RAJA_INLINE void store_n(T *ptr, register_type const &a, camp::idx_t n)
+  {
+    for (camp::idx_t i = 0; i < n; ++i) {
+      ptr[i] = a.v[i];
+    }
+  }
+
+  static RAJA_INLINE T get(register_type const &a, camp::idx_t i)
+  {
+    return a.v[i];
+  }
+
+  static RAJA_INLINE register_type set(register_type a, camp::idx_t i, T b)
+  {
+    a.v[i] = b;
+    return a;
+  }
+
+#define RAJA_VECTOR_REGISTER_BINARY_OP(NAME, EXPR)                            \
+  static RAJA_INLINE register_type NAME(register_type const &a,              \
+                                        register_type const &b)              \
+  {                                                                          \
+    register_type r;                                                         \
+    RAJA_SIMD                                                                \
+    for (camp::idx_t i = 0; i < Width; ++i) {                                \
+      r.v[i] = EXPR;                                                         \
+    }                                                                        \
+    return r;                                                                \
+  }
+
+  RAJA_VECTOR_REGISTER_BINARY_OP(add, a.v[i] + b.v[i])
+  RAJA_VECTOR_REGISTER_BINARY_OP(subtract, a.v[i] - b.v[i])
+  RAJA_VECTOR_REGISTER_BINARY_OP(multiply, a.v[i] * b.v[i])
+  RAJA_VECTOR_REGISTER_BINARY_OP(divide, a.v[i] / b.v[i])
+  RAJA_VECTOR_REGISTER_BINARY_OP(min, a.v[i] < b.v[i] ? a.v[i] : b.v[i])
+  RAJA_VECTOR_REGISTER_BINARY_OP(max, a.v[i] < b.v[i] ? b.v[i] : a.v[i])
+
+#undef RAJA_VECTOR_REGISTER_BINARY_OP
+
+  static RAJA_INLINE register_type fma(register_type const &a,
+                                       register_type const &b,
+                                       register_type const &c)
+  {
+    register_type r;
+    RAJA_SIMD
+    for (camp::idx_t i = 0; i < Width; ++i) {
+      r.v[i] = a.v[i] * b.v[i] + c.v[i];
+    }
+    return r;
+  }
+
+  static RAJA_INLINE T sum(register_type const &a)
+  {
+    T r = a.v[0];
+    for (camp::idx_t i = 1; i < Width; ++i) {
+      r += a.v[i];
+    }
+    return r;
+  }
+};
+
+template <typename T, camp::idx_t Width>
+constexpr bool VectorRegister<T, Width>::is_native;
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,233 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   SSE2 vector registers: 2 doubles and 4 floats.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_vector_internal_register_sse_HPP
+#define RAJA_pattern_vector_internal_register_sse_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(__SSE2__)
+
+#include <emmintrin.h>
+
+#include "RAJA/pattern/vector/internal/register_scalar.hpp"
+
+namespace RAJA
+{
+namespace internal
+{
+
+/*
+ * SSE2 has no masked loads or stores, so partial accesses go through a
+ * zeroed stack buffer.
+ */
+
+template <>
+struct VectorRegister<double, 2> {
+  using register_type = __m128d;
+
+  static constexpr bool is_native = true;
+
+  static RAJA_INLINE register_type broadcast(double a)
+  {
+    return _mm_set1_pd(a);
+  }
+
+  static RAJA_INLINE register_type load(double const *ptr)
+  {
+    return _mm_loadu_pd(ptr);
+  }
+
+  static RAJA_INLINE register_type load_n(double const *ptr, camp::idx_t n)
+  {
+    return n > 0 ? _mm_load_sd(ptr) : _mm_setzero_pd();
+  }
+
+  static RAJA_INLINE void store(double *ptr, register_type a)
+  {
+    _mm_storeu_pd(ptr, a);
+  }
+
+  static RAJA_INLINE void store_n(double *ptr, register_type a, camp::idx_t n)
+  {
+    if (n > 0) {
+      _mm_store_sd(ptr, a);
+    }
+  }
+
+  static RAJA_INLINE double get(register_type a, camp::idx_t i)
+  {
+    alignas(16) double v[2];
+    _mm_store_pd(v, a);
+    return v[i];
+  }
+
+  static RAJA_INLINE register_type set(register_type a, camp::idx_t i, double b)
+  {
+    alignas(16) double v[2];
+    _mm_store_pd(v, a);
+    v[i] = b;
+    return _mm_load_pd(v);
+  }
+
+  static RAJA_INLINE register_type add(register_type a, register_type b)
+  {
+    return _mm_add_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type subtract(register_type a, register_type b)
+  {
+    return _mm_sub_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type multiply(register_type a, register_type b)
+  {
+    return _mm_mul_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type divide(register_type a, register_type b)
+  {
+    return _mm_div_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type min(register_type a, register_type b)
+  {
+    return _mm_min_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type max(register_type a, register_type b)
+  {
+    return _mm_max_pd(a, b);
+  }
+
+  static RAJA_INLINE register_type fma(register_type a,
+                                       register_type b,
+                                       register_type c)
+  {
+    return _mm_add_pd(_mm_mul_pd(a, b), c);
+  }
+
+  static RAJA_INLINE double sum(register_type a)
+  {
+    return _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a)));
+  }
+};
+
+template <>
+struct VectorRegister<float, 4> {
+  using register_type = __m128;
+
+  static constexpr bool is_native = true;
+
+  static RAJA_INLINE register_type broadcast(float a)
+  {
+    return _mm_set1_ps(a);
+  }
+
+  static RAJA_INLINE register_type load(float const *ptr)
+  {
+    return _mm_loadu_ps(ptr);
+  }
+
+  static RAJA_INLINE register_type load_n(float const *ptr, camp::idx_t n)
+  {
+    alignas(16) float v[4] = {0.f, 0.f, 0.f, 0.f};
+    for (camp::idx_t i = 0; i < n; ++i) {
+      v[i] = ptr[i];
+    }
+    return _mm_load_ps(v);
+  }
+
+  static RAJA_INLINE void store(float *ptr, register_type a)
+  {
+    _mm_storeu_ps(ptr, a);
+  }
+
+  static RAJA_INLINE void store_n(float *ptr, register_type a, camp::idx_t n)
+  {
+    alignas(16) float v[4];
+    _mm_store_ps(v, a);
+    for (camp::idx_t i = 0; i < n; ++i) {
+      ptr[i] = v[i];
+    }
+  }
+
+  static RAJA_INLINE float get(register_type a, camp::idx_t i)
+  {
+    alignas(16) float v[4];
+    _mm_store_ps(v, a);
+    return v[i];
+  }
+
+  static RAJA_INLINE register_type set(register_type a, camp::idx_t i, float b)
+  {
+    alignas(16) float v[4];
+    _mm_store_ps(v, a);
+    v[i] = b;
+    return _mm_load_ps(v);
+  }
+
+  static RAJA_INLINE register_type add(register_type a, register_type b)
+  {
+    return _mm_add_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type subtract(register_type a, register_type b)
+  {
+    return _mm_sub_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type multiply(register_type a, register_type b)
+  {
+    return _mm_mul_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type divide(register_type a, register_type b)
+  {
+    return _mm_div_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type min(register_type a, register_type b)
+  {
+    return _mm_min_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type max(register_type a, register_type b)
+  {
+    return _mm_max_ps(a, b);
+  }
+
+  static RAJA_INLINE register_type fma(register_type a,
+                                       register_type b,
+                                       register_type c)
+  {
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+  }
+
+  static RAJA_INLINE float sum(register_type a)
+  {
+    __m128 s = _mm_add_ps(a, _mm_movehl_ps(a, a));
+    return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+  }
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // __SSE2__
+
+#endif
@@ -21,5 +21,6 @@
 #define RAJA_policy_loop_kernel_HPP
 
 #include "RAJA/policy/loop/kernel/Collapse.hpp"
+#include "RAJA/policy/loop/kernel/CurveCollapse.hpp"
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,202 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for kernel Collapse policies that iterate over
+ *          indices in space-filling curve order
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#ifndef RAJA_policy_loop_kernel_CurveCollapse_HPP
+#define RAJA_policy_loop_kernel_CurveCollapse_HPP
+
+#include "RAJA/pattern/kernel.hpp"
+
+#include "RAJA/policy/PolicyBase.hpp"
+#include "RAJA/policy/loop/policy.hpp"
+
+#include "RAJA/util/HilbertLayout.hpp"
+#include "RAJA/util/MortonLayout.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Collapse policy that visits the collapsed indices in Morton (Z-order)
+ * curve order, matching the storage order of a RAJA::MortonLayout with the
+ * same sizes.
+ */
+struct morton_collapse_exec
+    : make_policy_pattern_launch_platform_t<Policy::loop,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  template <size_t n_dims, typename IdxLin>
+  using layout_t = MortonLayout<n_dims, IdxLin>;
+};
+
+/*!
+ * Collapse policy that visits the collapsed indices in Hilbert curve order,
+ * matching the storage order of a RAJA::HilbertLayout with the same sizes.
+ */
+struct hilbert_collapse_exec
+    : make_policy_pattern_launch_platform_t<Policy::loop,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  template <size_t n_dims, typename IdxLin>
+  using layout_t = HilbertLayout<n_dims, IdxLin>;
+};
+
+/*!
+ * The curve collapse policies order the points of a whole Collapse box, so
+ * they are not forall policies; a loop split off a Collapse, such as a
+ * hyperplane of statement::Hyperplane, runs under loop_exec instead (see
+ * internal::CollapseForallPolicy).
+ */
+template <typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    resources::Host &host_res,
+    const morton_collapse_exec &,
+    Iterable &&,
+    Func &&)
+{
+  static_assert(!std::is_same<Iterable, Iterable>::value,
+                "morton_collapse_exec is only a statement::Collapse policy, "
+                "use loop_exec to run a single loop");
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
+template <typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    resources::Host &host_res,
+    const hilbert_collapse_exec &,
+    Iterable &&,
+    Func &&)
+{
+  static_assert(!std::is_same<Iterable, Iterable>::value,
+                "hilbert_collapse_exec is only a statement::Collapse policy, "
+                "use loop_exec to run a single loop");
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
+namespace internal
+{
+
+template <>
+struct CollapseForallPolicy<morton_collapse_exec> {
+  using type = loop_exec;
+};
+
+template <>
+struct CollapseForallPolicy<hilbert_collapse_exec> {
+  using type = loop_exec;
+};
+
+/*!
+ * Walks the linear index space of the curve layout, skipping the aligned
+ * blocks of padding that lie outside the segments, and executes the
+ * enclosed statements for every point inside them.
+ */
+template <typename CurvePolicy,
+          typename ArgList,
+          typename Types,
+          typename... EnclosedStmts>
+struct CurveCollapseExecutor;
+
+template <typename CurvePolicy,
+          camp::idx_t... Args,
+          typename Types,
+          typename... EnclosedStmts>
+struct CurveCollapseExecutor<CurvePolicy,
+                             ArgList<Args...>,
+                             Types,
+                             EnclosedStmts...> {
+
+  static_assert(sizeof...(Args) > 0,
+                "Curve collapse policies need at least one argument");
+
+  static constexpr size_t n_dims = sizeof...(Args);
+
+  using layout_t =
+      typename CurvePolicy::template layout_t<n_dims, Index_type>;
+
+  template <typename Data, camp::idx_t... Seq>
+  static RAJA_INLINE void assign(Data &data,
+                                 Index_type const (&idx)[n_dims],
+                                 camp::idx_seq<Seq...>)
+  {
+    camp::sink((data.template assign_offset<
+                    camp::seq_at<Seq, camp::idx_seq<Args...>>::value>(
+                    idx[Seq]),
+                0)...);
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    // Set the argument types for these loops
+    using NewTypes = setSegmentTypesFromData<Types, Data, Args...>;
+
+    bool const non_empty = foldl(RAJA::operators::logical_and<bool>(),
+                                 (segment_length<Args>(data) > 0)...);
+    if (!non_empty) {
+      return;
+    }
+
+    layout_t const layout(segment_length<Args>(data)...);
+    Index_type const size = layout.size();
+
+    Index_type idx[n_dims];
+    for (Index_type lin = 0; lin < size;) {
+      layout.toIndexArray(lin, idx);
+
+      if (layout.inBounds(idx)) {
+        assign(data, idx, camp::make_idx_seq_t<n_dims>{});
+        execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(data);
+        ++lin;
+      } else {
+        lin += layout.skipLength(lin, idx);
+      }
+    }
+  }
+};
+
+
+template <camp::idx_t... Args, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::Collapse<morton_collapse_exec,
+                                             ArgList<Args...>,
+                                             EnclosedStmts...>, Types>
+    : CurveCollapseExecutor<morton_collapse_exec,
+                            ArgList<Args...>,
+                            Types,
+                            EnclosedStmts...> {
+};
+
+template <camp::idx_t... Args, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::Collapse<hilbert_collapse_exec,
+                                             ArgList<Args...>,
+                                             EnclosedStmts...>, Types>
+    : CurveCollapseExecutor<hilbert_collapse_exec,
+                            ArgList<Args...>,
+                            Types,
+                            EnclosedStmts...> {
+};
+
+
+}  // namespace internal
+
+}  // end namespace RAJA
+
+
+#endif /* RAJA_policy_loop_kernel_CurveCollapse_HPP */
@@ -27,9 +27,11 @@
 
 #include <iostream>
 #include <type_traits>
+#include <vector>
 
 #include <omp.h>
 
+#include "RAJA/util/ThreadLoad.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/internal/fault_tolerance.hpp"
@@ -54,12 +56,96 @@ namespace omp
 ///
 /// OpenMP parallel policy implementation
 ///
+
+namespace internal
+{
+
+  /// The inner policy of an instrumented parallel loop: the end of the loop
+  /// must not be a barrier, so that each thread can time its own share.
+  template <typename InnerPolicy>
+  struct nowait_policy {
+    using type = InnerPolicy;
+  };
+
+  template <typename Schedule>
+  struct nowait_policy<omp_for_schedule_exec<Schedule>> {
+    using type = omp_for_nowait_schedule_exec<Schedule>;
+  };
+
+} // end namespace internal
+
+///
+/// OpenMP parallel policy implementation that records the busy time, the
+/// barrier wait time and the number of iterates of each thread, see
+/// util::thread_loads_enabled().  For index sets the iterates are segments.
+///
+template <typename Iterable, typename Func, typename InnerPolicy>
+RAJA_INLINE void forall_thread_loads(resources::Host &host_res,
+                                     const omp_parallel_exec<InnerPolicy>&,
+                                     Iterable&& iter,
+                                     Func&& loop_body)
+{
+  using NoWaitPolicy = typename internal::nowait_policy<InnerPolicy>::type;
+
+  std::vector<util::ThreadLoad> loads(omp_get_max_threads());
+  std::vector<double> finish(loads.size(), 0.0);
+  int num_threads = 1;
+
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    auto& private_body = body.get_priv();
+
+    std::size_t count = 0;
+    double const start = omp_get_wtime();
+    forall_impl(host_res, NoWaitPolicy{}, iter, [&](auto&& i) {
+      ++count;
+      private_body(std::forward<decltype(i)>(i));
+    });
+    double const stop = omp_get_wtime();
+
+    std::size_t const tid = omp_get_thread_num();
+    if (tid < loads.size()) {
+      loads[tid].busy_time = stop - start;
+      loads[tid].iterations = count;
+      finish[tid] = stop;
+    }
+    if (tid == 0) {
+      num_threads = omp_get_num_threads();
+    }
+  });
+
+  if (loads.size() > std::size_t(num_threads)) {
+    loads.resize(num_threads);
+  }
+  double last = 0.0;
+  for (std::size_t t = 0; t < loads.size(); ++t) {
+    last = finish[t] > last ? finish[t] : last;
+  }
+
+  // accumulate, so that a kernel with several parallel loops reports them all
+  auto& total = util::last_thread_loads();
+  if (total.size() < loads.size()) {
+    total.resize(loads.size());
+  }
+  for (std::size_t t = 0; t < loads.size(); ++t) {
+    total[t].busy_time += loads[t].busy_time;
+    total[t].wait_time += last - finish[t];
+    total[t].iterations += loads[t].iterations;
+  }
+}
+
 template <typename Iterable, typename Func, typename InnerPolicy>
 RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host &host_res,
-                                                    const omp_parallel_exec<InnerPolicy>&,
+                                                    const omp_parallel_exec<InnerPolicy>& p,
                                                     Iterable&& iter,
                                                     Func&& loop_body)
 {
+  if (util::thread_loads_enabled()) {
+    forall_thread_loads(host_res, p, iter, loop_body);
+    return resources::EventProxy<resources::Host>(&host_res);
+  }
+
   RAJA::region<RAJA::omp_parallel_region>([&]() {
     using RAJA::internal::thread_privatize;
     auto body = thread_privatize(loop_body);
@@ -207,6 +293,68 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host&
   return resources::EventProxy<resources::Host>(&host_res);
 }
 
+///
+/// OpenMP taskloop policy implementation
+///
+
+namespace internal
+{
+
+  /// Runs the loop as tasks of grainsize iterations, each with its own
+  /// private copy of the loop body.  Must be called by a single thread.
+  template <typename Iterable, typename Func>
+  RAJA_INLINE void forall_taskloop(int grainsize,
+                                   Iterable&& iter,
+                                   Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    using diff_t = decltype(distance_it);
+
+    // by default, aim for several tasks per thread
+    diff_t chunk = grainsize > 0
+                       ? diff_t(grainsize)
+                       : distance_it / diff_t(8 * omp_get_num_threads());
+    if (chunk < 1) {
+      chunk = 1;
+    }
+    diff_t const num_chunks = (distance_it + chunk - 1) / chunk;
+
+    // tasks refer to the body through a pointer, so that each can privatize
+    // it once rather than once per iteration
+    auto *body = &loop_body;
+
+    #pragma omp taskloop grainsize(1)
+    for (diff_t c = 0; c < num_chunks; ++c) {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(*body);
+      auto &private_body = privatizer.get_priv();
+
+      diff_t const last =
+          (c + 1) * chunk < distance_it ? (c + 1) * chunk : distance_it;
+      for (diff_t i = c * chunk; i < last; ++i) {
+        private_body(begin_it[i]);
+      }
+    }
+  }
+
+} // end namespace internal
+
+template <int Grainsize, typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host& host_res,
+                                                               const omp_taskloop_exec<Grainsize>&,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  if (omp_in_parallel()) {
+    internal::forall_taskloop(Grainsize, iter, loop_body);
+  } else {
+    RAJA::region<RAJA::omp_task_region>([&]() {
+      internal::forall_taskloop(Grainsize, iter, loop_body);
+    });
+  }
+  return resources::EventProxy<resources::Host>(&host_res);
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
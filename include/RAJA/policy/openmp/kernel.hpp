@@ -20,6 +20,9 @@
 #define RAJA_policy_openmp_kernel_HPP
 
 #include "RAJA/policy/openmp/kernel/Collapse.hpp"
+#include "RAJA/policy/openmp/kernel/InitLocalMem.hpp"
 #include "RAJA/policy/openmp/kernel/OmpSyncThreads.hpp"
+#include "RAJA/policy/openmp/kernel/RecursiveTile.hpp"
+#include "RAJA/policy/openmp/kernel/Task.hpp"
 
 #endif  // closing endif for header file include guard
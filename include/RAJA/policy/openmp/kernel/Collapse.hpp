@@ -27,111 +27,129 @@
 #include "RAJA/pattern/kernel/Collapse.hpp"
 #include "RAJA/pattern/kernel/internal.hpp"
 
+#include "RAJA/pattern/region.hpp"
+
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/policy/openmp/forall.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 
 namespace RAJA
 {
 
-struct omp_parallel_collapse_exec
+/*!
+ * Collapses any number of kernel loops into a single OpenMP parallel loop
+ * over their combined iteration space, distributed with the given
+ * policy::omp schedule (Auto, Static<N>, Dynamic<N>, Guided<N> or Runtime).
+ */
+template <typename Schedule>
+struct omp_parallel_collapse_schedule_exec
     : make_policy_pattern_t<RAJA::Policy::openmp,
                             RAJA::Pattern::forall,
                             RAJA::policy::omp::For> {
+  using schedule = Schedule;
 };
 
+using omp_parallel_collapse_exec =
+    omp_parallel_collapse_schedule_exec<policy::omp::Auto>;
+
 namespace internal
 {
 
-/////////
-// Collapsing two loops
-/////////
-
-template <camp::idx_t Arg0, camp::idx_t Arg1, typename... EnclosedStmts, typename Types>
-struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
-                                             ArgList<Arg0, Arg1>,
-                                             EnclosedStmts...>, Types> {
-
-
-  template <typename Data>
-  static RAJA_INLINE void exec(Data&& data)
-  {
-    const auto l0 = segment_length<Arg0>(data);
-    const auto l1 = segment_length<Arg1>(data);
-    // NOTE: these are here to avoid a use-after-scope detected by address
-    // sanitizer, probably a false positive, but the result should be
-    // essentially identical
-    auto i0 = l0;
-    auto i1 = l1;
-
-    // Set the argument types for this loop
-    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
-    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
-
-    using RAJA::internal::thread_privatize;
-    auto privatizer = thread_privatize(data);
-#pragma omp parallel for private(i0, i1) firstprivate(privatizer) \
-    RAJA_COLLAPSE(2)
-    for (i0 = 0; i0 < l0; ++i0) {
-      for (i1 = 0; i1 < l1; ++i1) {
-        auto& private_data = privatizer.get_priv();
-        private_data.template assign_offset<Arg0>(i0);
-        private_data.template assign_offset<Arg1>(i1);
-        execute_statement_list<camp::list<EnclosedStmts...>, NewTypes1>(private_data);
-      }
-    }
-  }
+template <typename Schedule>
+struct CollapseForallPolicy<omp_parallel_collapse_schedule_exec<Schedule>> {
+  using type = omp_parallel_exec<omp_for_schedule_exec<Schedule>>;
 };
 
-
-template <camp::idx_t Arg0,
-          camp::idx_t Arg1,
-          camp::idx_t Arg2,
+/*!
+ * Each thread walks its share of the linearized index space with an
+ * odometer over the loop offsets, which only needs to be recomputed by
+ * division when the schedule hands the thread a new chunk.  The offsets
+ * index into the segments, so any segment type may be collapsed.
+ */
+template <typename Schedule,
+          camp::idx_t... Args,
           typename... EnclosedStmts,
           typename Types>
-struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
-                                             ArgList<Arg0, Arg1, Arg2>,
-                                             EnclosedStmts...>, Types> {
+struct StatementExecutor<
+    statement::Collapse<omp_parallel_collapse_schedule_exec<Schedule>,
+                        ArgList<Args...>,
+                        EnclosedStmts...>,
+    Types> {
+
+  static_assert(sizeof...(Args) > 0,
+                "omp_parallel_collapse_exec needs at least one argument");
 
+  static constexpr size_t n_dims = sizeof...(Args);
+
+  template <typename Data, camp::idx_t... Seq>
+  static RAJA_INLINE void assign(Data &data,
+                                 Index_type const (&idx)[n_dims],
+                                 camp::idx_seq<Seq...>)
+  {
+    camp::sink((data.template assign_offset<
+                    camp::seq_at<Seq, camp::idx_seq<Args...>>::value>(
+                    idx[Seq]),
+                0)...);
+  }
 
   template <typename Data>
-  static RAJA_INLINE void exec(Data&& data)
+  static RAJA_INLINE void exec(Data &&data)
   {
-    const auto l0 = segment_length<Arg0>(data);
-    const auto l1 = segment_length<Arg1>(data);
-    const auto l2 = segment_length<Arg2>(data);
-    auto i0 = l0;
-    auto i1 = l1;
-    auto i2 = l2;
-
-    // Set the argument types for this loop
-    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
-    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
-    using NewTypes2 = setSegmentTypeFromData<NewTypes1, Arg2, Data>;
-
-    using RAJA::internal::thread_privatize;
-    auto privatizer = thread_privatize(data);
-#pragma omp parallel for private(i0, i1, i2) firstprivate(privatizer) \
-    RAJA_COLLAPSE(3)
-    for (i0 = 0; i0 < l0; ++i0) {
-      for (i1 = 0; i1 < l1; ++i1) {
-        for (i2 = 0; i2 < l2; ++i2) {
-          auto& private_data = privatizer.get_priv();
-          private_data.template assign_offset<Arg0>(i0);
-          private_data.template assign_offset<Arg1>(i1);
-          private_data.template assign_offset<Arg2>(i2);
-          execute_statement_list<camp::list<EnclosedStmts...>, NewTypes2>(private_data);
-        }
+    // Set the argument types for these loops
+    using NewTypes = setSegmentTypesFromData<Types, Data, Args...>;
+
+    Index_type const len[n_dims] = {
+        static_cast<Index_type>(segment_length<Args>(data))...};
+
+    Index_type total = 1;
+    for (size_t d = 0; d < n_dims; ++d) {
+      if (len[d] <= 0) {
+        return;
       }
+      total *= len[d];
     }
+
+    RAJA::region<RAJA::omp_parallel_region>([&]() {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(data);
+      auto &private_data = privatizer.get_priv();
+
+      Index_type idx[n_dims] = {};
+      Index_type next = -1;
+
+      RAJA::policy::omp::internal::forall_impl(
+          Schedule{},
+          TypedRangeSegment<Index_type>(0, total),
+          [&](Index_type lin) {
+            if (lin == next) {
+              // step to the next point, carrying into outer loops
+              for (size_t d = n_dims; d-- > 0;) {
+                if (++idx[d] < len[d]) {
+                  break;
+                }
+                idx[d] = 0;
+              }
+            } else {
+              // start of a new chunk
+              Index_type rem = lin;
+              for (size_t d = n_dims; d-- > 0;) {
+                idx[d] = rem % len[d];
+                rem /= len[d];
+              }
+            }
+            next = lin + 1;
+
+            assign(private_data, idx, camp::make_idx_seq_t<n_dims>{});
+            execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(
+                private_data);
+          });
+    });
   }
 };
 
 
-
-
-
 }  // namespace internal
 }  // namespace RAJA
 
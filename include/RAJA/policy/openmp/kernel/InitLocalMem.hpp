@@ -0,0 +1,85 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for OpenMP team-shared local arrays.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_InitLocalMem_HPP
+#define RAJA_policy_openmp_kernel_InitLocalMem_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include "RAJA/pattern/kernel/InitLocalMem.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+/*!
+ * Statement executor to initalize RAJA local arrays shared by the threads
+ * of the enclosing OpenMP parallel region.
+ *
+ * Every thread of the team must reach the statement, e.g. directly inside
+ * statement::Region<omp_parallel_region>.  One thread takes the memory from
+ * its arena and all threads wait for it; the arrays may be reused once all
+ * threads have left the enclosed statements.  Threads filling and reading
+ * the arrays in the enclosed statements are separated by OmpSyncThreads.
+ */
+template<camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_team_shared_mem,camp::idx_seq<Indices...>, EnclosedStmts...>, Types>{
+
+  template<typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using local_mem_t = CpuArenaLocalMem<camp::decay<Data>, Indices...>;
+
+    // Only the thread that runs the single block holds the level
+    CpuArena::Level level;
+    void *mem = nullptr;
+
+    #pragma omp single copyprivate(mem)
+    {
+      mem = level.acquire(CpuArena::get(), local_mem_t::bytes());
+    }
+
+    local_mem_t::assign(data, mem);
+
+    execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+
+    local_mem_t::clear(data);
+
+    #pragma omp barrier
+  }
+
+};
+
+
+}  // namespace internal
+}  // namespace RAJA
+
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
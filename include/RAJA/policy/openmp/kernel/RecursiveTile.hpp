@@ -0,0 +1,76 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for the OpenMP task-parallel RecursiveTile.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_RecursiveTile_HPP
+#define RAJA_policy_openmp_kernel_RecursiveTile_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include "RAJA/pattern/kernel/RecursiveTile.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/pattern/region.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Runs a RecursiveTile in a new OpenMP parallel region, with the first half
+ * of every split executed as an OpenMP task.  Reductions in the enclosed
+ * statements need a thread-safe reduction policy such as omp_reduce.
+ */
+struct omp_parallel_task_exec
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::region,
+                            RAJA::policy::omp::Parallel> {
+};
+
+namespace internal
+{
+
+template <>
+struct RecursiveTileSpawn<omp_parallel_task_exec> {
+
+  template <typename Executor, typename Data>
+  static RAJA_INLINE void spawn(Data &data)
+  {
+    // the task gets its own copy of the loop data, segments included
+    camp::decay<Data> task_data(data);
+#pragma omp task firstprivate(task_data)
+    Executor::recurse(task_data);
+  }
+
+  template <typename Executor, typename Data>
+  static RAJA_INLINE void run(Data &data)
+  {
+    RAJA::region<RAJA::omp_task_region>([&]() { Executor::recurse(data); });
+  }
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
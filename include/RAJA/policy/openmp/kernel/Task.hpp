@@ -0,0 +1,96 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for OpenMP task statements in kernels.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_task_HPP
+#define RAJA_policy_openmp_kernel_task_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+namespace statement
+{
+
+/*!
+ * A RAJA::kernel statement that executes its enclosed statements as an
+ * OpenMP task, with a copy of the current loop indices and segments.
+ *
+ * Tasks are run by the threads of the enclosing parallel region, which is
+ * usually created by a Region<omp_task_region, ...> statement, so each
+ * iteration of an irregular outer loop can be balanced dynamically:
+ *
+ *   Region<omp_task_region,
+ *     For<0, seq_exec,
+ *       Task<For<1, loop_exec, Lambda<0>>>>>
+ *
+ * Reductions in the enclosed statements need an OpenMP reduction policy.
+ */
+template <typename... EnclosedStmts>
+struct Task : public internal::Statement<camp::nil, EnclosedStmts...> {
+};
+
+/*!
+ * A RAJA::kernel statement that waits for the completion of the tasks
+ * created so far by the current task (or region), e.g. before using the
+ * results of Task statements in later statements.
+ */
+struct TaskWait : public internal::Statement<camp::nil> {
+};
+
+}  // namespace statement
+
+namespace internal
+{
+
+template <typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::Task<EnclosedStmts...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    camp::decay<Data> task_data(data);
+#pragma omp task firstprivate(task_data)
+    execute_statement_list<camp::list<EnclosedStmts...>, Types>(task_data);
+  }
+};
+
+template <typename Types>
+struct StatementExecutor<statement::TaskWait, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&)
+  {
+#pragma omp taskwait
+  }
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
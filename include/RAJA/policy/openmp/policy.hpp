@@ -72,6 +72,9 @@ struct For {
 struct NoWait {
 };
 
+struct TaskLoop {
+};
+
 static constexpr int default_chunk_size = -1;
 
 struct Auto : private internal::Schedule<omp_sched_auto, default_chunk_size>{
@@ -105,6 +108,17 @@ struct omp_parallel_region
                                             Platform::host> {
 };
 
+///
+/// Parallel region whose body is executed by a single thread, which creates
+/// OpenMP tasks for the whole team (statement::Task, omp_taskloop_exec).
+///
+struct omp_task_region
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 template <typename Sched>
 struct omp_for_nowait_schedule_exec : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                               Pattern::forall,
@@ -136,6 +150,22 @@ using omp_for_nowait_exec = omp_for_nowait_schedule_exec<Auto>;
 template <unsigned int N>
 using omp_for_static = omp_for_schedule_exec<omp::Static<N>>;
 
+///
+/// Executes the loop as OpenMP tasks of Grainsize iterations each (or a
+/// runtime-chosen number if Grainsize is 0), for load balancing loops of
+/// irregular cost.  Inside a parallel region it must be encountered by one
+/// thread, e.g. in an omp_task_region; outside of one it creates its own.
+///
+template <int Grainsize = 0>
+struct omp_taskloop_exec : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                              Pattern::forall,
+                                                              Launch::undefined,
+                                                              Platform::host,
+                                                              omp::TaskLoop> {
+  static_assert(Grainsize >= 0, "Grainsize must not be negative");
+  static constexpr int grainsize = Grainsize;
+};
+
 template <typename InnerPolicy>
 using omp_parallel_exec = make_policy_pattern_launch_platform_t<Policy::openmp,
                                             Pattern::forall,
@@ -211,6 +241,8 @@ using policy::omp::omp_parallel_segit;
 using policy::omp::omp_reduce;
 using policy::omp::omp_reduce_ordered;
 using policy::omp::omp_synchronize;
+using policy::omp::omp_task_region;
+using policy::omp::omp_taskloop_exec;
 using policy::omp::omp_work;
 
 }  // namespace RAJA
@@ -46,6 +46,25 @@ RAJA_INLINE void region_impl(const omp_parallel_region &, Func &&body)
     }
 }
 
+/*!
+ * \brief RAJA::region implementation for OpenMP tasking.
+ *
+ * Generates an OpenMP parallel region in which the body is executed once,
+ * by a single thread; the tasks it creates are run by the whole team and
+ * are complete when the region ends.
+ *
+ */
+template <typename Func>
+RAJA_INLINE void region_impl(const omp_task_region &, Func &&body)
+{
+
+#pragma omp parallel
+  {
+#pragma omp single
+    body();
+  }
+}
+
 }  // namespace omp
 
 }  // namespace policy
@@ -35,6 +35,8 @@
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/pattern/detail/privatizer.hpp"
+
 #include "RAJA/policy/simd/policy.hpp"
 
 namespace RAJA
@@ -45,6 +47,80 @@ namespace simd
 {
 
 
+namespace detail
+{
+
+// One lane's private copy, constructed in place since privatizers of
+// kernel wrappers refer to their own members and must not be copied
+template <typename T, camp::idx_t Lane>
+struct SimdLane {
+  using privatizer_type =
+      decltype(RAJA::internal::thread_privatize(camp::val<T const &>()));
+
+  privatizer_type privatizer;
+
+  RAJA_INLINE SimdLane(T const &item) : privatizer(item) {}
+};
+
+template <typename T, typename Seq>
+struct SimdLanes;
+
+template <typename T, camp::idx_t... Lanes>
+struct SimdLanes<T, camp::idx_seq<Lanes...>> : SimdLane<T, Lanes>... {
+
+  RAJA_INLINE SimdLanes(T const &item) : SimdLane<T, Lanes>(item)... {}
+
+  template <camp::idx_t Lane>
+  RAJA_INLINE auto get_priv()
+      -> decltype(static_cast<SimdLane<T, Lane> &>(*this).privatizer.get_priv())
+  {
+    return static_cast<SimdLane<T, Lane> &>(*this).privatizer.get_priv();
+  }
+};
+
+/*!
+ * Calls body(item_l, i) for i in [0, distance), where item_l is a private
+ * copy of item made with thread_privatize for lane l = i % simd_lanes.  Each
+ * lane touches only its own copy, so the loop over the lanes is a SIMD loop
+ * and each copy's state, such as a reducer's partial result, stays in its
+ * lane.
+ */
+template <typename Distance,
+          typename T,
+          typename Body,
+          camp::idx_t... Lanes>
+RAJA_INLINE void simd_lanes_exec(Distance distance,
+                                 T const &item,
+                                 Body &&body,
+                                 camp::idx_seq<Lanes...>)
+{
+  constexpr Distance num_lanes = sizeof...(Lanes);
+
+  using lanes_type = SimdLanes<T, camp::idx_seq<Lanes...>>;
+  using lane_type = typename std::remove_reference<
+      decltype(camp::val<lanes_type &>().template get_priv<0>())>::type;
+
+  lanes_type lanes(item);
+  lane_type *lane[num_lanes] = {&lanes.template get_priv<Lanes>()...};
+
+  Distance i = 0;
+  for (; i + num_lanes <= distance; i += num_lanes) {
+    RAJA_SIMD
+    for (Distance l = 0; l < num_lanes; ++l) {
+      body(*lane[l], i + l);
+    }
+  }
+
+  Distance const rest = distance - i;
+  RAJA_SIMD
+  for (Distance l = 0; l < rest; ++l) {
+    body(*lane[l], i + l);
+  }
+}
+
+}  // namespace detail
+
+
 template <typename Iterable, typename Func>
 RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::Host &host_res,
                                                                const simd_exec &,
@@ -62,6 +138,27 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::
   return RAJA::resources::EventProxy<resources::Host>(&host_res);
 }
 
+template <typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::Host &host_res,
+                                                               const simd_reduce_exec &,
+                                                               Iterable &&iter,
+                                                               Func &&loop_body)
+{
+  static_assert(std::is_copy_constructible<camp::decay<Func>>::value,
+                "simd_reduce_exec gives each lane a copy of the loop body, "
+                "which must be copy constructible");
+
+  auto begin = std::begin(iter);
+  auto distance = std::distance(begin, std::end(iter));
+  detail::simd_lanes_exec(distance,
+                          loop_body,
+                          [=](camp::decay<Func> &body,
+                              decltype(distance) i) { body(*(begin + i)); },
+                          camp::make_idx_seq_t<simd_lanes>{});
+
+  return RAJA::resources::EventProxy<resources::Host>(&host_res);
+}
+
 }  // namespace simd
 
 }  // namespace policy
@@ -25,6 +25,7 @@
 
 #include "RAJA/pattern/kernel/internal.hpp"
 #include "RAJA/pattern/kernel/Lambda.hpp"
+#include "RAJA/policy/simd/forall.hpp"
 #include "RAJA/policy/simd/policy.hpp"
 
 namespace RAJA
@@ -129,6 +130,47 @@ struct StatementExecutor<
 };
 
 
+/*!
+ * RAJA::kernel forall_impl executor specialization for statement::For.
+ * Assumptions: RAJA::simd_reduce_exec is the inner most policy,
+ * only one lambda is used, and reductions within the lambda use
+ * simd_reduce.  Assigns the loop index to offset ArgumentId
+ */
+template <camp::idx_t ArgumentId, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<
+    statement::For<ArgumentId, RAJA::simd_reduce_exec, EnclosedStmts...>,
+    Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+
+    // Set the argument type for this loop
+    using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+    auto iter = get<ArgumentId>(data.segment_tuple);
+    auto begin = std::begin(iter);
+    auto end = std::end(iter);
+    auto distance = std::distance(begin, end);
+
+    // Privatize data per lane, which keeps the partial results of
+    // simd_reduce reducers in different lanes independent
+    using data_type = camp::decay<Data>;
+    RAJA::policy::simd::detail::simd_lanes_exec(
+        distance,
+        data,
+        [](data_type &private_data, decltype(distance) i) {
+          // Assign offset on privatized data
+          private_data.template assign_offset<ArgumentId>(i);
+
+          Invoke_all_Lambda<NewTypes, EnclosedStmts...>::lambda_special(
+              private_data);
+        },
+        camp::make_idx_seq_t<RAJA::policy::simd::simd_lanes>{});
+  }
+};
+
+
 }  // namespace internal
 }  // end namespace RAJA
 
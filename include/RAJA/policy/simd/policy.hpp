@@ -44,11 +44,43 @@ struct simd_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                          Platform::host> {
 };
 
+///
+/// simd_exec for loop bodies that hold simd_reduce reducers.  Each of
+/// simd_lanes lanes runs on its own copy of the loop body, so the partial
+/// results of the reducers in different lanes are independent and the lanes
+/// vectorize.
+///
+struct simd_reduce_exec
+    : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+///
+/// Number of lanes, and private copies of the loop body, of simd_reduce_exec
+/// loops; 8 lanes fill an AVX-512 register of doubles or two AVX registers.
+///
+constexpr camp::idx_t simd_lanes = 8;
+
+///
+/// Reduction policy for use in simd_reduce_exec loops, alone or nested in
+/// OpenMP parallel loops.
+///
+struct simd_reduce : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                                           Pattern::forall,
+                                                           Launch::undefined,
+                                                           Platform::host> {
+};
+
 }  // end of namespace simd
 
 }  // end of namespace policy
 
 using policy::simd::simd_exec;
+using policy::simd::simd_reduce_exec;
+using policy::simd::simd_reduce;
+using policy::simd::simd_lanes;
 
 }  // end of namespace RAJA
 
@@ -0,0 +1,86 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA reduction templates for SIMD
+ *          execution.
+ *
+ *          These methods should work on any platform.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_simd_reduce_HPP
+#define RAJA_simd_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/reduce.hpp"
+
+#include "RAJA/policy/simd/policy.hpp"
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Each copy accumulates into a plain member, so once simd_reduce_exec has
+ * given every lane its own copy of the loop body the compiler keeps the
+ * partial results in vector registers.  Copies combine into the original when
+ * destroyed; inside an OpenMP parallel region that is done in a critical
+ * section, so lanes of different threads may share one reducer.
+ */
+template <typename T, typename Reduce>
+class ReduceSimd
+    : public reduce::detail::BaseCombinable<T, Reduce, ReduceSimd<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceSimd>;
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceSimd() = delete;
+
+  using Base::Base;
+
+  ~ReduceSimd()
+  {
+    if (Base::parent && Base::my_data != Base::identity) {
+#if defined(RAJA_ENABLE_OPENMP)
+      if (omp_in_parallel()) {
+#pragma omp critical(simdReduceCritical)
+        Reduce()(Base::parent->local(), Base::my_data);
+      } else {
+        Reduce()(Base::parent->local(), Base::my_data);
+      }
+#else
+      Reduce()(Base::parent->local(), Base::my_data);
+#endif
+      Base::my_data = Base::identity;
+    }
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(simd_reduce, detail::ReduceSimd)
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -25,6 +25,8 @@
 
 #if defined(RAJA_ENABLE_TBB)
 
+#include <vector>
+
 #include <tbb/tbb.h>
 
 #include "RAJA/index/IndexSet.hpp"
@@ -33,6 +35,7 @@
 #include "RAJA/internal/fault_tolerance.hpp"
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
+#include "RAJA/util/ThreadLoad.hpp"
 #include "RAJA/util/types.hpp"
 
 
@@ -52,6 +55,67 @@ namespace tbb
 {
 
 
+#if TBB_VERSION_MAJOR >= 2017
+/**
+ * @brief TBB for implementation that records the busy time, the wait time
+ * and the number of iterates of each thread of the arena
+ *
+ * This is used instead of the other implementations while
+ * util::thread_loads_enabled().  A thread waits for the part of the loop
+ * that it does not spend executing iterates.
+ */
+template <typename Iterable, typename Func, typename Partitioner>
+RAJA_INLINE void forall_thread_loads(size_t grain_size,
+                                     Iterable&& iter,
+                                     Func&& loop_body,
+                                     Partitioner&& partitioner)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using brange = ::tbb::blocked_range<size_t>;
+  auto b = begin(iter);
+  size_t dist = std::abs(distance(begin(iter), end(iter)));
+
+  std::vector<util::ThreadLoad> loads(
+      ::tbb::this_task_arena::max_concurrency());
+
+  ::tbb::tick_count const start = ::tbb::tick_count::now();
+  ::tbb::parallel_for(
+      brange(0, dist, grain_size),
+      [&](const brange& r) {
+        ::tbb::tick_count const chunk_start = ::tbb::tick_count::now();
+        using RAJA::internal::thread_privatize;
+        auto privatizer = thread_privatize(loop_body);
+        auto body = privatizer.get_priv();
+        for (auto i = r.begin(); i != r.end(); ++i)
+          body(b[i]);
+
+        // each slot is only written by the thread with that index
+        int slot = ::tbb::this_task_arena::current_thread_index();
+        if (slot >= 0 && size_t(slot) < loads.size()) {
+          loads[slot].busy_time +=
+              (::tbb::tick_count::now() - chunk_start).seconds();
+          loads[slot].iterations += r.size();
+        }
+      },
+      partitioner);
+  double const wall = (::tbb::tick_count::now() - start).seconds();
+
+  auto& total = util::last_thread_loads();
+  if (total.size() < loads.size()) {
+    total.resize(loads.size());
+  }
+  for (size_t t = 0; t < loads.size(); ++t) {
+    total[t].busy_time += loads[t].busy_time;
+    total[t].wait_time += wall > loads[t].busy_time
+                              ? wall - loads[t].busy_time
+                              : 0.0;
+    total[t].iterations += loads[t].iterations;
+  }
+}
+#endif
+
 /**
  * @brief TBB dynamic for implementation
  *
@@ -74,6 +138,14 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host &
                                                                Iterable&& iter,
                                                                Func&& loop_body)
 {
+#if TBB_VERSION_MAJOR >= 2017
+  if (util::thread_loads_enabled()) {
+    forall_thread_loads(
+        p.grain_size, iter, loop_body, ::tbb::auto_partitioner{});
+    return resources::EventProxy<resources::Host>(&host_res);
+  }
+#endif
+
   using std::begin;
   using std::distance;
   using std::end;
@@ -117,6 +189,13 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host &
                                                                Iterable&& iter,
                                                                Func&& loop_body)
 {
+#if TBB_VERSION_MAJOR >= 2017
+  if (util::thread_loads_enabled()) {
+    forall_thread_loads(ChunkSize, iter, loop_body, tbb_static_partitioner{});
+    return resources::EventProxy<resources::Host>(&host_res);
+  }
+#endif
+
   using std::begin;
   using std::distance;
   using std::end;
@@ -0,0 +1,27 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA headers for explicit vector execution.
+ *
+ *          These methods work on all platforms.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_vector_HPP
+#define RAJA_vector_HPP
+
+#include "RAJA/policy/vector/forall.hpp"
+#include "RAJA/policy/vector/policy.hpp"
+#include "RAJA/policy/vector/kernel/For.hpp"
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,105 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA index set and segment iteration
+ *          template methods for explicit vector execution.
+ *
+ *          These methods should work on any platform.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_vector_HPP
+#define RAJA_forall_vector_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/internal/fault_tolerance.hpp"
+
+#include "RAJA/policy/vector/policy.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace vector
+{
+
+
+template <typename Iterable, typename Func, typename VectorType>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<resources::Host>,
+    detail::is_unit_stride_segment<camp::decay<Iterable>>>
+forall_impl(RAJA::resources::Host &host_res,
+            const vector_exec<VectorType> &,
+            Iterable &&iter,
+            Func &&loop_body)
+{
+  using index_type = camp::decay<decltype(*std::begin(iter))>;
+  using vector_index = VectorIndex<index_type, VectorType>;
+  constexpr camp::idx_t width = VectorType::width;
+
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+
+  decltype(distance) i = 0;
+  for (; i + width <= distance; i += width) {
+    loop_body(vector_index(*(begin + i), width));
+  }
+
+  if (i < distance) {
+    loop_body(vector_index(*(begin + i), distance - i));
+  }
+
+  return RAJA::resources::EventProxy<resources::Host>(&host_res);
+}
+
+/*!
+ * Iterates of other segments need not be consecutive, so they are executed
+ * one at a time.
+ */
+template <typename Iterable, typename Func, typename VectorType>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<resources::Host>,
+    concepts::negate<detail::is_unit_stride_segment<camp::decay<Iterable>>>>
+forall_impl(RAJA::resources::Host &host_res,
+            const vector_exec<VectorType> &,
+            Iterable &&iter,
+            Func &&loop_body)
+{
+  using index_type = camp::decay<decltype(*std::begin(iter))>;
+  using vector_index = VectorIndex<index_type, VectorType>;
+
+  auto begin = std::begin(iter);
+  auto end = std::end(iter);
+  auto distance = std::distance(begin, end);
+
+  for (decltype(distance) i = 0; i < distance; ++i) {
+    loop_body(vector_index(*(begin + i), 1));
+  }
+
+  return RAJA::resources::EventProxy<resources::Host>(&host_res);
+}
+
+}  // namespace vector
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,164 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the kernel statement::For executor with
+ *          vector_exec.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_vector_kernel_For_HPP
+#define RAJA_policy_vector_kernel_For_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/policy/vector/policy.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+/*
+ * Executes the enclosed statements once for a remainder of n < width
+ * iterations.  Lambdas build their arguments from the segment value alone, so
+ * the lane count is carried in the argument type: the remainder is
+ * dispatched to a VectorTailIndex with matching N.
+ */
+template <camp::idx_t ArgumentId,
+          typename IndexType,
+          typename VectorType,
+          camp::idx_t N,
+          typename Stmts,
+          typename Types>
+struct VectorTailExecutor {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data, camp::idx_t n)
+  {
+    if (n == N) {
+      using NewTypes =
+          setSegmentType<Types,
+                         ArgumentId,
+                         detail::VectorTailIndex<IndexType, VectorType, N>>;
+      execute_statement_list<Stmts, NewTypes>(data);
+    } else {
+      VectorTailExecutor<ArgumentId, IndexType, VectorType, N - 1, Stmts, Types>::
+          exec(data, n);
+    }
+  }
+};
+
+template <camp::idx_t ArgumentId,
+          typename IndexType,
+          typename VectorType,
+          typename Stmts,
+          typename Types>
+struct VectorTailExecutor<ArgumentId, IndexType, VectorType, 0, Stmts, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &, camp::idx_t)
+  {
+  }
+};
+
+
+/*!
+ * RAJA::kernel executor specialization for statement::For with vector_exec.
+ * The enclosed statements see argument ArgumentId as a
+ * VectorIndex<IndexType, VectorType> covering VectorType::width iterations,
+ * or fewer for the last one.  Segments other than unit-stride ranges are
+ * executed one iterate at a time, with VectorIndex arguments of size() 1.
+ */
+template <camp::idx_t ArgumentId,
+          typename VectorType,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::For<ArgumentId, RAJA::vector_exec<VectorType>, EnclosedStmts...>,
+    Types> {
+
+  using stmts = camp::list<EnclosedStmts...>;
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using segment_type =
+        camp::at_v<typename camp::decay<Data>::segment_tuple_t::TList,
+                   ArgumentId>;
+    exec_segment(
+        data,
+        policy::vector::detail::is_unit_stride_segment<segment_type>{});
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void exec_segment(Data &data, std::false_type)
+  {
+    using index_type =
+        camp::at_v<typename camp::decay<Data>::index_tuple_t::TList,
+                   ArgumentId>;
+    using NewTypes =
+        setSegmentType<Types,
+                       ArgumentId,
+                       detail::VectorTailIndex<index_type, VectorType, 1>>;
+
+    auto len = segment_length<ArgumentId>(data);
+    using len_t = decltype(len);
+
+    for (len_t i = 0; i < len; ++i) {
+      data.template assign_offset<ArgumentId>(i);
+      execute_statement_list<stmts, NewTypes>(data);
+    }
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void exec_segment(Data &data, std::true_type)
+  {
+    using index_type =
+        camp::at_v<typename camp::decay<Data>::index_tuple_t::TList,
+                   ArgumentId>;
+    using NewTypes =
+        setSegmentType<Types, ArgumentId, VectorIndex<index_type, VectorType>>;
+
+    constexpr camp::idx_t width = VectorType::width;
+
+    auto len = segment_length<ArgumentId>(data);
+    using len_t = decltype(len);
+
+    len_t i = 0;
+    for (; i + width <= len; i += width) {
+      data.template assign_offset<ArgumentId>(i);
+      execute_statement_list<stmts, NewTypes>(data);
+    }
+
+    if (i < len) {
+      data.template assign_offset<ArgumentId>(i);
+      VectorTailExecutor<ArgumentId,
+                         index_type,
+                         VectorType,
+                         width - 1,
+                         stmts,
+                         Types>::exec(data, camp::idx_t(len - i));
+    }
+  }
+};
+
+
+}  // namespace internal
+}  // end namespace RAJA
+
+
+#endif
@@ -0,0 +1,99 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA explicit vector policy definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_vector_HPP
+#define policy_vector_HPP
+
+#include <type_traits>
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/Iterators.hpp"
+
+#include "RAJA/util/Span.hpp"
+
+#include "RAJA/pattern/vector/Vector.hpp"
+#include "RAJA/pattern/vector/VectorIndex.hpp"
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+///
+/// Segment execution policies
+///
+namespace RAJA
+{
+namespace policy
+{
+namespace vector
+{
+
+/*!
+ * Executes VectorType::width iterations at a time, passing the loop body a
+ * VectorIndex<IdxT, VectorType>.  The last, partial, vector has size() less
+ * than the width, so loads and stores through Views are masked.
+ *
+ * Only unit-stride ranges are executed a vector at a time.  Other segments
+ * (strided ranges, lists) are executed one iterate at a time, each passed
+ * as a VectorIndex with size() 1.
+ */
+template <typename VectorType>
+struct vector_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                                           Pattern::forall,
+                                                           Launch::undefined,
+                                                           Platform::host> {
+  using vector_type = VectorType;
+};
+
+namespace detail
+{
+
+//! Whether consecutive iterates of Segment are consecutive indices
+template <typename Segment>
+struct is_unit_stride_segment : std::false_type {
+};
+
+template <typename StorageT, typename DiffT>
+struct is_unit_stride_segment<TypedRangeSegment<StorageT, DiffT>>
+    : std::true_type {
+};
+
+//! kernel wraps its segments in Spans of their iterators
+template <typename Type, typename DiffT, typename PtrT, typename IndexType>
+struct is_unit_stride_segment<
+    Span<Iterators::numeric_iterator<Type, DiffT, PtrT>, IndexType>>
+    : std::true_type {
+};
+
+}  // namespace detail
+
+}  // end of namespace vector
+
+}  // end of namespace policy
+
+using policy::vector::vector_exec;
+
+}  // end of namespace RAJA
+
+#endif
@@ -0,0 +1,421 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining AoSoA, an array-of-structs-of-arrays
+ *          container, and views of its fields.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_AOSOA_HPP
+#define RAJA_AOSOA_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/SoAArray.hpp"
+#include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * @brief One field of an AoSoA block: VectorLength contiguous values.
+ *
+ * The field index I keeps members with the same type distinct.
+ */
+template <camp::idx_t I, typename T, size_t VectorLength>
+struct AoSoAMember {
+  SoAArray<T, VectorLength> lanes;
+};
+
+template <typename Seq, typename Types, size_t VectorLength>
+struct AoSoABlock;
+
+/*!
+ * @brief A block of an AoSoA: a struct of arrays of VectorLength elements.
+ */
+template <camp::idx_t... Is, typename... Ts, size_t VectorLength>
+struct AoSoABlock<camp::idx_seq<Is...>, camp::list<Ts...>, VectorLength>
+    : AoSoAMember<Is, Ts, VectorLength>... {
+};
+
+/*!
+ * Returns the lanes of field I of a block; T is deduced from the base class.
+ */
+template <camp::idx_t I, typename T, size_t VectorLength>
+RAJA_HOST_DEVICE RAJA_INLINE SoAArray<T, VectorLength> &aosoa_member(
+    AoSoAMember<I, T, VectorLength> &member)
+{
+  return member.lanes;
+}
+
+template <camp::idx_t I, typename T, size_t VectorLength>
+RAJA_HOST_DEVICE RAJA_INLINE SoAArray<T, VectorLength> const &aosoa_member(
+    AoSoAMember<I, T, VectorLength> const &member)
+{
+  return member.lanes;
+}
+
+}  // namespace detail
+
+
+/*!
+ * @brief A view of one field of an AoSoA.
+ *
+ * Element i lives in lane (i % VectorLength) of block (i / VectorLength).
+ * Views are cheap to copy and may be captured in kernel bodies.
+ *
+ * lanes(block) returns a pointer to the VectorLength contiguous values of a
+ * block, suitable for simd_exec or RAJA_SIMD loops:
+ *
+ *     auto x = particles.view<0>();
+ *     auto v = particles.view<1>();
+ *
+ *     RAJA::forall<RAJA::loop_exec>(
+ *         RAJA::RangeSegment(0, particles.num_blocks()), [=](int b) {
+ *       double *xb = x.lanes(b);
+ *       double const *vb = v.lanes(b);
+ *       RAJA::forall<RAJA::simd_exec>(
+ *           RAJA::RangeSegment(0, VL), [=](int l) { xb[l] += dt * vb[l]; });
+ *     });
+ */
+template <typename T, size_t VectorLength>
+struct AoSoAFieldView {
+  using value_type = T;
+
+  static constexpr size_t vector_length = VectorLength;
+
+  char *data;
+  size_t block_bytes;
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr AoSoAFieldView()
+      : data{nullptr}, block_bytes{0}
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr AoSoAFieldView(
+      value_type *first_lanes,
+      size_t bytes_per_block)
+      : data{reinterpret_cast<char *>(first_lanes)}, block_bytes{bytes_per_block}
+  {
+  }
+
+  template <typename Idx>
+  RAJA_HOST_DEVICE RAJA_INLINE value_type *lanes(Idx block) const
+  {
+    return reinterpret_cast<value_type *>(
+        data + static_cast<size_t>(stripIndexType(block)) * block_bytes);
+  }
+
+  template <typename Idx>
+  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()(Idx i) const
+  {
+    size_t const ii = static_cast<size_t>(stripIndexType(i));
+    return lanes(ii / VectorLength)[ii % VectorLength];
+  }
+
+  template <typename BIdx, typename LIdx>
+  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()(BIdx block,
+                                                      LIdx lane) const
+  {
+    return lanes(block)[stripIndexType(lane)];
+  }
+};
+
+template <typename T, size_t VectorLength>
+constexpr size_t AoSoAFieldView<T, VectorLength>::vector_length;
+
+
+/*!
+ * @brief Array-of-structs-of-arrays container.
+ *
+ * Stores the fields of Tuple in blocks of VectorLength elements.  Within a
+ * block each field is contiguous, so the lanes of a field load as one SIMD
+ * vector, while all fields of an element share a block and so sit in the
+ * same page.  For 10+ fields this avoids both the strided loads of an
+ * array of structs and the one-stream-per-field pressure on the TLB and
+ * prefetchers of a struct of arrays.
+ *
+ *     using Particles = RAJA::AoSoA<camp::tuple<double, double, int>, 8>;
+ *     Particles p(n);
+ *     p.get<0>(i) = 1.0;
+ *     auto x = p.view<0>();      // AoSoAFieldView, capture in kernels
+ *
+ * The storage is padded to a whole number of blocks; padding lanes are
+ * zero initialized so whole-block loops need no remainder handling.
+ * Fields must be trivially copyable.  Memory comes from a RAJA
+ * basic_mempool, as for SoAPtr, aligned to Alignment bytes.
+ */
+template <typename Tuple,
+          size_t VectorLength,
+          typename mempool = RAJA::basic_mempool::MemPool<
+              RAJA::basic_mempool::generic_allocator>,
+          size_t Alignment = 64>
+class AoSoA;
+
+template <typename... Ts, size_t VectorLength, typename mempool, size_t Alignment>
+class AoSoA<camp::tuple<Ts...>, VectorLength, mempool, Alignment>
+{
+  static_assert(VectorLength > 0, "VectorLength must be positive");
+  static_assert(
+      concepts::all_of<std::is_trivially_copyable<Ts>...>::value,
+      "AoSoA fields must be trivially copyable");
+
+public:
+  using tuple_type = camp::tuple<Ts...>;
+  using field_types = camp::list<Ts...>;
+  using block_type = detail::AoSoABlock<camp::make_idx_seq_t<sizeof...(Ts)>,
+                                        field_types,
+                                        VectorLength>;
+
+  template <camp::idx_t I>
+  using field_type = camp::at_v<field_types, I>;
+
+  template <camp::idx_t I>
+  using field_view_type = AoSoAFieldView<field_type<I>, VectorLength>;
+
+  static constexpr size_t vector_length = VectorLength;
+  static constexpr size_t num_fields = sizeof...(Ts);
+
+  AoSoA() = default;
+
+  explicit AoSoA(size_t size) { allocate(size); }
+
+  AoSoA(AoSoA const &) = delete;
+  AoSoA &operator=(AoSoA const &) = delete;
+
+  AoSoA(AoSoA &&rhs) : m_blocks(rhs.m_blocks), m_size(rhs.m_size)
+  {
+    rhs.m_blocks = nullptr;
+    rhs.m_size = 0;
+  }
+
+  AoSoA &operator=(AoSoA &&rhs)
+  {
+    if (this != &rhs) {
+      deallocate();
+      m_blocks = rhs.m_blocks;
+      m_size = rhs.m_size;
+      rhs.m_blocks = nullptr;
+      rhs.m_size = 0;
+    }
+    return *this;
+  }
+
+  ~AoSoA() { deallocate(); }
+
+  /*!
+   * Allocates zero initialized storage for size elements, releasing any
+   * previous storage.
+   */
+  AoSoA &allocate(size_t size)
+  {
+    deallocate();
+    m_size = size;
+    if (size > 0) {
+      m_blocks = mempool::getInstance().template malloc<block_type>(
+          num_blocks(), Alignment);
+      if (m_blocks == nullptr) {
+        RAJA_ABORT_OR_THROW("AoSoA allocation failed");
+      }
+      std::memset(static_cast<void *>(m_blocks),
+                  0,
+                  num_blocks() * sizeof(block_type));
+    }
+    return *this;
+  }
+
+  AoSoA &deallocate()
+  {
+    if (m_blocks != nullptr) {
+      mempool::getInstance().free(m_blocks);
+      m_blocks = nullptr;
+    }
+    m_size = 0;
+    return *this;
+  }
+
+  bool allocated() const { return m_blocks != nullptr; }
+
+  //! Number of elements.
+  size_t size() const { return m_size; }
+
+  //! Number of blocks of VectorLength elements.
+  size_t num_blocks() const
+  {
+    return (m_size + VectorLength - 1) / VectorLength;
+  }
+
+  //! Number of elements including the padding of the last block.
+  size_t padded_size() const { return num_blocks() * VectorLength; }
+
+  block_type *data() { return m_blocks; }
+  block_type const *data() const { return m_blocks; }
+
+  template <camp::idx_t I>
+  field_type<I> &get(size_t i)
+  {
+    return detail::aosoa_member<I>(
+        m_blocks[i / VectorLength])[i % VectorLength];
+  }
+
+  template <camp::idx_t I>
+  field_type<I> const &get(size_t i) const
+  {
+    return detail::aosoa_member<I>(
+        m_blocks[i / VectorLength])[i % VectorLength];
+  }
+
+  //! Returns a view of field I.
+  template <camp::idx_t I>
+  field_view_type<I> view() const
+  {
+    return field_view_type<I>(
+        m_blocks != nullptr
+            ? const_cast<field_type<I> *>(
+                  detail::aosoa_member<I>(m_blocks[0]).data())
+            : nullptr,
+        sizeof(block_type));
+  }
+
+  tuple_type get_tuple(size_t i) const
+  {
+    return get_tuple_impl(i, camp::make_idx_seq_t<num_fields>{});
+  }
+
+  void set_tuple(size_t i, tuple_type const &value)
+  {
+    set_tuple_impl(i, value, camp::make_idx_seq_t<num_fields>{});
+  }
+
+  /*!
+   * Copies size() elements from an array of structs, given pointers to the
+   * members holding each field in order:
+   *
+   *     p.copy_from_aos(particles, &Particle::x, &Particle::v, &Particle::id);
+   */
+  template <typename S, typename... Ms>
+  void copy_from_aos(S const *src, Ms S::*... members)
+  {
+    static_assert(sizeof...(Ms) == num_fields,
+                  "one member pointer is needed per field");
+    copy_from_aos_impl(src, camp::make_idx_seq_t<num_fields>{}, members...);
+  }
+
+  //! Copies size() elements to an array of structs, see copy_from_aos.
+  template <typename S, typename... Ms>
+  void copy_to_aos(S *dst, Ms S::*... members) const
+  {
+    static_assert(sizeof...(Ms) == num_fields,
+                  "one member pointer is needed per field");
+    copy_to_aos_impl(dst, camp::make_idx_seq_t<num_fields>{}, members...);
+  }
+
+  //! Copies size() elements from one array per field.
+  void copy_from_soa(Ts const *... src)
+  {
+    copy_from_soa_impl(camp::make_idx_seq_t<num_fields>{}, src...);
+  }
+
+  //! Copies size() elements to one array per field.
+  void copy_to_soa(Ts *... dst) const
+  {
+    copy_to_soa_impl(camp::make_idx_seq_t<num_fields>{}, dst...);
+  }
+
+private:
+  template <camp::idx_t... Is>
+  tuple_type get_tuple_impl(size_t i, camp::idx_seq<Is...>) const
+  {
+    return tuple_type(get<Is>(i)...);
+  }
+
+  template <camp::idx_t... Is>
+  void set_tuple_impl(size_t i, tuple_type const &value, camp::idx_seq<Is...>)
+  {
+    camp::sink((get<Is>(i) = camp::get<Is>(value))...);
+  }
+
+  template <typename S, camp::idx_t... Is, typename... Ms>
+  void copy_from_aos_impl(S const *src, camp::idx_seq<Is...>, Ms S::*... members)
+  {
+    for (size_t i = 0; i < m_size; ++i) {
+      camp::sink((get<Is>(i) = src[i].*members)...);
+    }
+  }
+
+  template <typename S, camp::idx_t... Is, typename... Ms>
+  void copy_to_aos_impl(S *dst, camp::idx_seq<Is...>, Ms S::*... members) const
+  {
+    for (size_t i = 0; i < m_size; ++i) {
+      camp::sink((dst[i].*members = get<Is>(i))...);
+    }
+  }
+
+  // fields are copied one at a time so each pass streams one source array
+  template <camp::idx_t I, typename T>
+  void copy_field_from(T const *src)
+  {
+    for (size_t i = 0; i < m_size; ++i) {
+      get<I>(i) = src[i];
+    }
+  }
+
+  template <camp::idx_t I, typename T>
+  void copy_field_to(T *dst) const
+  {
+    for (size_t i = 0; i < m_size; ++i) {
+      dst[i] = get<I>(i);
+    }
+  }
+
+  template <camp::idx_t... Is>
+  void copy_from_soa_impl(camp::idx_seq<Is...>, Ts const *... src)
+  {
+    camp::sink((copy_field_from<Is>(src), 0)...);
+  }
+
+  template <camp::idx_t... Is>
+  void copy_to_soa_impl(camp::idx_seq<Is...>, Ts *... dst) const
+  {
+    camp::sink((copy_field_to<Is>(dst), 0)...);
+  }
+
+  block_type *m_blocks = nullptr;
+  size_t m_size = 0;
+};
+
+template <typename... Ts, size_t VectorLength, typename mempool, size_t Alignment>
+constexpr size_t
+    AoSoA<camp::tuple<Ts...>, VectorLength, mempool, Alignment>::vector_length;
+
+template <typename... Ts, size_t VectorLength, typename mempool, size_t Alignment>
+constexpr size_t
+    AoSoA<camp::tuple<Ts...>, VectorLength, mempool, Alignment>::num_fields;
+
+}  // namespace RAJA
+
+#endif /* RAJA_AOSOA_HPP */
@@ -0,0 +1,62 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for querying the data cache sizes of the host.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_CacheInfo_HPP
+#define RAJA_util_CacheInfo_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+
+namespace RAJA
+{
+namespace util
+{
+
+/*!
+ * @brief Sizes of the data caches seen by one core of the host.
+ *
+ * The sizes are read once, on first use, from sysfs on Linux, from cpuid on
+ * other x86 hosts, and default to 32KiB/1MiB/32MiB with 64 byte lines where
+ * neither is available.  The environment variables RAJA_CACHE_L1,
+ * RAJA_CACHE_L2 and RAJA_CACHE_L3 (in bytes) override the detected sizes.
+ */
+struct CacheInfo {
+  static constexpr int num_levels = 3;
+
+  size_t line_bytes;
+  size_t level_bytes[num_levels];
+};
+
+//! The host's cache sizes, detected on the first call
+const CacheInfo& cache_info();
+
+//! Size in bytes of data cache level 1, 2 or 3
+size_t cache_size(int level);
+
+/*!
+ * Returns the extent of a tile with num_dims equal extents and
+ * bytes_per_point bytes of data per point that fills about half of cache
+ * level, leaving the rest for data outside of the tile.  Extents of 16 or
+ * more are rounded down to a multiple of 8.
+ */
+size_t cache_tile_extent(int level, int num_dims, size_t bytes_per_point);
+
+}  // namespace util
+}  // namespace RAJA
+
+#endif
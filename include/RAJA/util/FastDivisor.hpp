@@ -0,0 +1,255 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining FastDivisor, an integer divisor with a
+ *          precomputed reciprocal for division-free quotients
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_FASTDIVISOR_HPP
+#define RAJA_FASTDIVISOR_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+template <size_t Bytes>
+struct fast_divide_uint {
+  using type = uint32_t;
+};
+
+template <>
+struct fast_divide_uint<8> {
+  using type = uint64_t;
+};
+
+/*!
+ * High word of the full product of two 32-bit unsigned integers.
+ */
+RAJA_INLINE RAJA_HOST_DEVICE uint32_t mul_high(uint32_t a, uint32_t b)
+{
+  return static_cast<uint32_t>((static_cast<uint64_t>(a) * b) >> 32);
+}
+
+/*!
+ * High word of the full product of two 64-bit unsigned integers.
+ */
+RAJA_INLINE RAJA_HOST_DEVICE uint64_t mul_high(uint64_t a, uint64_t b)
+{
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  return __umul64hi(a, b);
+#elif defined(__SIZEOF_INT128__)
+  return static_cast<uint64_t>((static_cast<unsigned __int128>(a) * b) >> 64);
+#else
+  uint64_t const a_lo = a & 0xffffffff, a_hi = a >> 32;
+  uint64_t const b_lo = b & 0xffffffff, b_hi = b >> 32;
+  uint64_t const lo_lo = a_lo * b_lo;
+  uint64_t const hi_lo = a_hi * b_lo;
+  uint64_t const lo_hi = a_lo * b_hi;
+  uint64_t const cross = (lo_lo >> 32) + (hi_lo & 0xffffffff) + lo_hi;
+  return a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+}
+
+/*!
+ * ceil(2^(31 + shift) / d) for d in [1, 2^31] and shift = ceil(log2(d)),
+ * computed with one 64-bit division.
+ */
+RAJA_INLINE RAJA_HOST_DEVICE constexpr uint32_t fast_divide_magic(uint32_t d,
+                                                                  int shift)
+{
+  return static_cast<uint32_t>(
+      ((uint64_t(1) << (31 + shift)) + d - 1) / d);
+}
+
+/*!
+ * ceil(2^(63 + shift) / d) for d in [1, 2^63] and shift = ceil(log2(d)),
+ * computed with one 128-bit division where the compiler provides one, and
+ * by long division otherwise.
+ */
+RAJA_INLINE RAJA_HOST_DEVICE constexpr uint64_t fast_divide_magic(uint64_t d,
+                                                                  int shift)
+{
+#if defined(__SIZEOF_INT128__) && !defined(__CUDA_ARCH__) && \
+    !defined(__HIP_DEVICE_COMPILE__)
+  return static_cast<uint64_t>(
+      ((static_cast<unsigned __int128>(1) << (63 + shift)) + d - 1) / d);
+#else
+  uint64_t magic = 0;
+  uint64_t rem = 1;
+  for (int i = 0; i < 63 + shift; ++i) {
+    // rem < d <= 2^63, so doubling it cannot overflow
+    rem <<= 1;
+    magic <<= 1;
+    if (rem >= d) {
+      rem -= d;
+      magic |= 1;
+    }
+  }
+  return rem != 0 ? magic + 1 : magic;
+#endif
+}
+
+/*!
+ * Number of significant bits of x, i.e. ceil(log2(x + 1)).
+ */
+template <typename U>
+RAJA_INLINE RAJA_HOST_DEVICE constexpr int fast_divide_bit_width(U x)
+{
+  int width = 0;
+  for (int step = 4 * int(sizeof(U)); step > 0; step /= 2) {
+    if (x >> step) {
+      x >>= step;
+      width += step;
+    }
+  }
+  return x != 0 ? width + 1 : width;
+}
+
+}  // namespace detail
+
+/*!
+ * @brief An integer divisor that replaces division by multiplication with a
+ * precomputed reciprocal ("magic number") and a shift.
+ *
+ * The reciprocal is computed once at construction, with a single
+ * double-width division, so quotients of 32- and 64-bit integers cost one
+ * high multiply and two shifts instead of an integer divide instruction.  This pays off when the same runtime divisor
+ * is used many times, as in Layout::toIndices.
+ *
+ *     FastDivisor<Index_type> d(7);
+ *     Index_type q = 100 / d;   // 14
+ *     Index_type r = 100 % d;   // 2
+ *
+ * Restricting numerators to the non-negative range of the signed type, one
+ * bit less than the full unsigned range, means a single magic number
+ * works for every divisor (Granlund and Montgomery, "Division by Invariant
+ * Integers using Multiplication", Theorem 4.2), so the quotient has no
+ * data-dependent branches or fix-ups and is cheap to inline and vectorize.
+ *
+ * Numerators must lie in [0, 2^(B-1)) and divisors in [1, 2^(B-1)], where B
+ * is the number of bits of T.  A divisor of zero is treated as one.
+ */
+template <typename T>
+struct FastDivisor {
+  static_assert(std::is_integral<T>::value,
+                "FastDivisor requires an integral type");
+
+  using value_type = T;
+  using unsigned_type = typename detail::fast_divide_uint<sizeof(T)>::type;
+
+  static constexpr int num_bits = 8 * sizeof(unsigned_type);
+
+  T divisor;
+  unsigned_type magic;
+  int shift;
+
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr FastDivisor()
+      : divisor{1}, magic{unsigned_type(1) << (num_bits - 1)}, shift{0}
+  {
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr FastDivisor(T d)
+      : divisor{d}, magic{0}, shift{0}
+  {
+    unsigned_type const ud = static_cast<unsigned_type>(d > 1 ? d : 1);
+
+    // shift = ceil(log2(d)), so magic fits in num_bits since
+    // d > 2^(shift - 1)
+    shift = detail::fast_divide_bit_width(ud - 1);
+    magic = detail::fast_divide_magic(ud, shift);
+  }
+
+  /*!
+   * Converts a divisor of another integer type, reusing its magic number
+   * and shift when both types have the same width.
+   */
+  template <typename U>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr explicit FastDivisor(
+      FastDivisor<U> const &other)
+      : FastDivisor(other,
+                    std::integral_constant<bool,
+                                           sizeof(typename FastDivisor<
+                                                  U>::unsigned_type) ==
+                                               sizeof(unsigned_type)>{})
+  {
+  }
+
+  /*!
+   * Returns n / divisor for 0 <= n < 2^(B-1).
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE T divide(T n) const
+  {
+    // floor(magic * n / 2^(B - 1 + shift)), with n pre-shifted so that the
+    // high word of the product drops the low B bits
+    unsigned_type const un = static_cast<unsigned_type>(n) << 1;
+    return static_cast<T>(detail::mul_high(magic, un) >> shift);
+  }
+
+  /*!
+   * Returns n % divisor for 0 <= n < 2^(B-1).
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE T modulo(T n) const
+  {
+    return n - divide(n) * (divisor > 1 ? divisor : T(1));
+  }
+
+private:
+  template <typename U>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr FastDivisor(
+      FastDivisor<U> const &other,
+      std::true_type)
+      : divisor{static_cast<T>(other.divisor)},
+        magic{other.magic},
+        shift{other.shift}
+  {
+  }
+
+  template <typename U>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr FastDivisor(
+      FastDivisor<U> const &other,
+      std::false_type)
+      : FastDivisor(static_cast<T>(other.divisor))
+  {
+  }
+};
+
+template <typename T>
+constexpr int FastDivisor<T>::num_bits;
+
+
+template <typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T operator/(T n, FastDivisor<T> const &d)
+{
+  return d.divide(n);
+}
+
+template <typename T>
+RAJA_INLINE RAJA_HOST_DEVICE T operator%(T n, FastDivisor<T> const &d)
+{
+  return d.modulo(n);
+}
+
+}  // namespace RAJA
+
+#endif
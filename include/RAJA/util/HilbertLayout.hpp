@@ -0,0 +1,351 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining HilbertLayout, a N-dimensional index
+ *          calculator that orders indices along a Hilbert curve
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_HILBERTLAYOUT_HPP
+#define RAJA_HILBERTLAYOUT_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <type_traits>
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/MortonLayout.hpp"
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Convert n_dims coordinates of num_bits each, in place, into the
+ * "transposed" Hilbert index, whose interleaved bits are the Hilbert index.
+ *
+ * This is J. Skilling's algorithm, "Programming the Hilbert curve",
+ * AIP Conf. Proc. 707 (2004).
+ */
+template <size_t n_dims>
+RAJA_INLINE RAJA_HOST_DEVICE void hilbert_axes_to_transpose(
+    uint64_t (&x)[n_dims],
+    int num_bits)
+{
+  if (num_bits == 0) {
+    return;
+  }
+
+  uint64_t const m = uint64_t(1) << (num_bits - 1);
+
+  // inverse undo
+  for (uint64_t q = m; q > 1; q >>= 1) {
+    uint64_t const p = q - 1;
+    for (size_t i = 0; i < n_dims; ++i) {
+      if (x[i] & q) {
+        x[0] ^= p;
+      } else {
+        uint64_t const t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  // gray encode
+  for (size_t i = 1; i < n_dims; ++i) {
+    x[i] ^= x[i - 1];
+  }
+  uint64_t t = 0;
+  for (uint64_t q = m; q > 1; q >>= 1) {
+    if (x[n_dims - 1] & q) {
+      t ^= q - 1;
+    }
+  }
+  for (size_t i = 0; i < n_dims; ++i) {
+    x[i] ^= t;
+  }
+}
+
+/*!
+ * Inverse of hilbert_axes_to_transpose.
+ */
+template <size_t n_dims>
+RAJA_INLINE RAJA_HOST_DEVICE void hilbert_transpose_to_axes(
+    uint64_t (&x)[n_dims],
+    int num_bits)
+{
+  if (num_bits == 0) {
+    return;
+  }
+
+  uint64_t const n = uint64_t(2) << (num_bits - 1);
+
+  // gray decode
+  uint64_t t = x[n_dims - 1] >> 1;
+  for (size_t i = n_dims - 1; i > 0; --i) {
+    x[i] ^= x[i - 1];
+  }
+  x[0] ^= t;
+
+  // undo excess work
+  for (uint64_t q = 2; q != n; q <<= 1) {
+    uint64_t const p = q - 1;
+    for (size_t i = n_dims; i-- > 0;) {
+      if (x[i] & q) {
+        x[0] ^= p;
+      } else {
+        t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+}
+
+
+template <typename Range, typename IdxLin = Index_type>
+struct HilbertLayout_impl;
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+struct HilbertLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> {
+public:
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::make_idx_seq_t<sizeof...(RangeInts)>;
+
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+
+  IdxLin sizes[n_dims];
+  uint64_t masks[n_dims];
+  int dim_bits;
+
+
+  /*!
+   * Default constructor with zero sizes.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr HilbertLayout_impl()
+      : sizes{0}, masks{0}, dim_bits{0}
+  {
+  }
+
+  /*!
+   * Construct a layout given the size of each dimension.
+   *
+   * The Hilbert curve is defined on a cube, so every dimension is padded to
+   * the smallest power of two that holds the largest size.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE HilbertLayout_impl(Types... ns)
+      : sizes{static_cast<IdxLin>(stripIndexType(ns))...},
+        masks{((void)RangeInts, uint64_t(0))...},
+        dim_bits{RAJA::max<int>(curve_bits(stripIndexType(ns))...)}
+  {
+    static_assert(n_dims == sizeof...(Types),
+                  "number of dimensions must match");
+
+    if (dim_bits * static_cast<int>(n_dims) >=
+        static_cast<int>(8 * sizeof(IdxLin)) - 1) {
+      RAJA_ABORT_OR_THROW("HilbertLayout: index space too large for IdxLin");
+    }
+
+    // the first index holds the most significant bit of each group
+    int pos = 0;
+    for (int b = 0; b < dim_bits; ++b) {
+      for (int d = static_cast<int>(n_dims) - 1; d >= 0; --d) {
+        masks[d] |= uint64_t(1) << pos;
+        ++pos;
+      }
+    }
+  }
+
+  /*!
+   * Methods to performs bounds checking in layout objects
+   */
+  template <camp::idx_t N, typename Idx>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheckError(Idx idx) const
+  {
+    printf("Error at index %d, value %ld is not within bounds [0, %ld] \n",
+           static_cast<int>(N),
+           static_cast<long int>(idx),
+           static_cast<long int>(sizes[N] - 1));
+    RAJA_ABORT_OR_THROW("Out of bounds error \n");
+  }
+
+  template <camp::idx_t N>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck() const
+  {
+  }
+
+  template <camp::idx_t N, typename Idx, typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck(Idx idx,
+                                                Indices... indices) const
+  {
+    if (sizes[N] > 0 && !(0 <= idx && idx < static_cast<Idx>(sizes[N]))) {
+      BoundsCheckError<N>(idx);
+    }
+    RAJA_UNUSED_VAR(idx);
+    BoundsCheck<N + 1>(indices...);
+  }
+
+  /*!
+   * Computes a linear space index from specified indices.
+   *
+   * Note that this operation requires O(n_dims * bits) integer operations,
+   * so it is noticeably more expensive than a MortonLayout.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE IdxLin operator()(Indices... indices) const
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    BoundsCheck<0>(indices...);
+#endif
+    uint64_t x[n_dims] = {static_cast<uint64_t>(stripIndexType(indices))...};
+    hilbert_axes_to_transpose(x, dim_bits);
+    return static_cast<IdxLin>(
+        sum<uint64_t>(bit_deposit(x[RangeInts], masks[RangeInts])...));
+  }
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+    uint64_t x[n_dims] = {
+        bit_extract(static_cast<uint64_t>(linear_index), masks[RangeInts])...};
+    hilbert_transpose_to_axes(x, dim_bits);
+    camp::sink((indices = (camp::decay<Indices>)x[RangeInts])...);
+  }
+
+  /*!
+   * Array form of toIndices, used by curve-ordered iteration.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndexArray(
+      IdxLin linear_index,
+      IdxLin (&indices)[n_dims]) const
+  {
+    toIndices(linear_index, indices[RangeInts]...);
+  }
+
+  /*!
+   * Returns true if indices lie within the (unpadded) sizes of this layout.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE bool inBounds(
+      IdxLin const (&indices)[n_dims]) const
+  {
+    return foldl(RAJA::operators::logical_and<bool>(),
+                 (indices[RangeInts] < (sizes[RangeInts] ? sizes[RangeInts]
+                                                         : IdxLin(1)))...);
+  }
+
+  /*!
+   * Given a linear index whose indices lie outside of the sizes of this
+   * layout, return the number of consecutive linear indices that can be
+   * skipped since they also lie outside.
+   *
+   * A block of 2^(n_dims*k) linear indices aligned to its length covers an
+   * aligned sub-cube of edge 2^k, so the block can be skipped when that
+   * sub-cube's lowest corner is out of bounds.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE IdxLin skipLength(
+      IdxLin linear_index,
+      IdxLin const (&indices)[n_dims]) const
+  {
+    IdxLin const remaining = size() - linear_index;
+    for (int k = dim_bits; k > 0; --k) {
+      IdxLin const block = IdxLin(1) << (k * static_cast<int>(n_dims));
+      if (linear_index % block != 0 || block > remaining) {
+        continue;
+      }
+      IdxLin const corner_mask = ~((IdxLin(1) << k) - 1);
+      IdxLin corner[n_dims] = {(indices[RangeInts] & corner_mask)...};
+      if (!inBounds(corner)) {
+        return block;
+      }
+    }
+    return 1;
+  }
+
+  /*!
+   * Computes a total size of the layout's space, including the padding of
+   * the sizes to a power-of-two cube.
+   *
+   * @return Total size spanned by indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return IdxLin(1) << (dim_bits * static_cast<int>(n_dims));
+  }
+};
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+constexpr size_t
+    HilbertLayout_impl<camp::idx_seq<RangeInts...>, IdxLin>::n_dims;
+
+}  // namespace detail
+
+/*!
+ * @brief A mapping of n-dimensional index space to a linear index space that
+ * follows a Hilbert space-filling curve.
+ *
+ * Consecutive linear indices always map to indices that are neighbors in
+ * exactly one dimension, which gives somewhat better locality than a
+ * MortonLayout at a higher cost per index computation.
+ *
+ * For example:
+ *
+ *     HilbertLayout<3> layout(32, 32, 32);
+ *
+ *     double *data = new double[layout.size()];
+ *
+ *     View<double, HilbertLayout<3>> view(data, layout);
+ *
+ * The index space is padded to a cube with a power-of-two edge, so this
+ * layout is best suited for roughly cubic sizes; use a MortonLayout
+ * otherwise.
+ *
+ * See RAJA::hilbert_collapse_exec for a kernel policy that iterates over
+ * indices in Hilbert order.
+ */
+template <size_t n_dims, typename IdxLin = Index_type>
+using HilbertLayout =
+    detail::HilbertLayout_impl<camp::make_idx_seq_t<n_dims>, IdxLin>;
+
+// lanes of a VectorIndex are not equally spaced along the curve
+template <camp::idx_t... RangeInts, typename IdxLin>
+struct is_affine_layout<
+    detail::HilbertLayout_impl<camp::idx_seq<RangeInts...>, IdxLin>>
+    : std::false_type {
+};
+
+}  // namespace RAJA
+
+#endif
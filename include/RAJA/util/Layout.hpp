@@ -28,6 +28,7 @@
 
 #include "RAJA/internal/foldl.hpp"
 
+#include "RAJA/util/FastDivisor.hpp"
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/Permutations.hpp"
 
@@ -110,8 +111,10 @@ public:
 
   IdxLin sizes[n_dims];
   IdxLin strides[n_dims];
-  IdxLin inv_strides[n_dims];
-  IdxLin inv_mods[n_dims];
+
+  // divisors used by toIndices, with precomputed reciprocals
+  FastDivisor<IdxLin> inv_strides[n_dims];
+  FastDivisor<IdxLin> inv_mods[n_dims];
 
 
   /*!
@@ -147,8 +150,8 @@ public:
           &rhs)
       : sizes{static_cast<IdxLin>(rhs.sizes[RangeInts])...},
         strides{static_cast<IdxLin>(rhs.strides[RangeInts])...},
-        inv_strides{static_cast<IdxLin>(rhs.inv_strides[RangeInts])...},
-        inv_mods{static_cast<IdxLin>(rhs.inv_mods[RangeInts])...}
+        inv_strides{FastDivisor<IdxLin>(rhs.inv_strides[RangeInts])...},
+        inv_mods{FastDivisor<IdxLin>(rhs.inv_mods[RangeInts])...}
   {
   }
 
@@ -224,7 +227,9 @@ public:
    * Given a linear-space index, compute the n-dimensional indices defined
    * by this layout.
    *
-   * Note that this operation requires 2n integer divide instructions
+   * Note that this operation requires 2n integer divisions, which are
+   * computed with the reciprocals precomputed at construction (see
+   * RAJA::FastDivisor) rather than with integer divide instructions.
    *
    * @param linear_index  Linear space index to be converted to indices.
    * @param indices  Variadic list of indices to be assigned, number must match
@@ -358,7 +363,8 @@ struct TypedLayout<IdxLin, camp::tuple<DimTypes...>, StrideOne>
    * Given a linear-space index, compute the n-dimensional indices defined
    * by this layout.
    *
-   * Note that this operation requires 2n integer divide instructions
+   * Note that this operation requires 2n integer divisions, see the
+   * untyped Layout::toIndices
    *
    * @param linear_index  Linear space index to be converted to indices.
    * @param indices  Variadic list of indices to be assigned, number must match
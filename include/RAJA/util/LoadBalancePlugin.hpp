@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_LoadBalance_Plugin_HPP
+#define RAJA_LoadBalance_Plugin_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginReport.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+#include "RAJA/util/ThreadLoad.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * Plugin that measures the load imbalance of the OpenMP and TBB loops.
+   * While it is active, those loops record the busy time, the wait time and
+   * the number of iterates of each thread (see ThreadLoad), and the plugin
+   * collects them per kernel name and policy.
+   *
+   * The imbalance of a launch is the busy time of the busiest thread over
+   * the mean busy time of the team; 1 is a perfect balance.  A high
+   * imbalance with balanced iterate counts means the work per iterate
+   * varies, which a Dynamic or Guided schedule evens out; a balanced launch
+   * is best served by a Static schedule.
+   *
+   * The plugin is only active when the environment variable
+   * RAJA_LOAD_BALANCE names a report file.  finalize_plugins() writes the
+   * report, sorted by total wait time, as JSON if the file name ends in
+   * ".json" and as CSV otherwise.
+   */
+  class LoadBalancePlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    struct KernelBalance {
+      std::string kernel_name;
+      std::string policy_name;
+      std::size_t calls = 0;
+      std::size_t threads = 0;
+      //! Sums over the launches of the max and mean busy time per thread
+      double max_busy_time = 0.0;
+      double mean_busy_time = 0.0;
+      //! The largest imbalance of a single launch
+      double max_imbalance = 0.0;
+      //! Thread-seconds spent waiting for the busiest thread
+      double wait_time = 0.0;
+      //! Sums over the launches of the max and mean iterates per thread
+      double max_iterations = 0.0;
+      double mean_iterations = 0.0;
+
+      double imbalance() const
+      {
+        return mean_busy_time > 0.0 ? max_busy_time / mean_busy_time : 1.0;
+      }
+      double iteration_imbalance() const
+      {
+        return mean_iterations > 0.0 ? max_iterations / mean_iterations : 1.0;
+      }
+    };
+
+    LoadBalancePlugin();
+
+    ~LoadBalancePlugin();
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! The kernels measured so far, sorted by decreasing wait time
+    std::vector<KernelBalance> getKernels() const;
+
+    void writeCSV(std::ostream& os) const;
+
+    void writeJSON(std::ostream& os) const;
+
+  private:
+    void record(const PluginContext& p, std::vector<ThreadLoad> const& loads);
+
+    std::string m_path;
+
+    detail::KernelReport<KernelBalance> m_kernels;
+
+  };  // end LoadBalancePlugin class
+
+  void linkLoadBalancePlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -0,0 +1,346 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining MixedLayout, a N-dimensional index
+ *          calculator whose sizes may each be compile-time or runtime
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_mixed_layout_HPP
+#define RAJA_util_mixed_layout_HPP
+
+#include "RAJA/config.hpp"
+
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/FastDivisor.hpp"
+#include "RAJA/util/Layout.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * Marks a MixedLayout extent whose size is given at runtime.
+ */
+constexpr camp::idx_t dynamic_extent = -1;
+
+namespace detail
+{
+
+/*!
+ * Number of dynamic extents before dimension d, ie. the position of the
+ * size of dimension d in the MixedLayout constructor arguments.
+ */
+template <camp::idx_t... Extents>
+RAJA_HOST_DEVICE constexpr camp::idx_t mixed_layout_dynamic_index(
+    camp::idx_t d)
+{
+  camp::idx_t const extents[] = {Extents...};
+  camp::idx_t count = 0;
+  for (camp::idx_t j = 0; j < d; ++j) {
+    count += extents[j] == dynamic_extent ? 1 : 0;
+  }
+  return count;
+}
+
+/*!
+ * Stride of dimension d if it is known at compile time, otherwise
+ * dynamic_extent.
+ *
+ * Zero-sized static extents are projections with stride zero, and count as
+ * one in the strides of the dimensions to their left.
+ */
+template <camp::idx_t... Extents>
+RAJA_HOST_DEVICE constexpr camp::idx_t mixed_layout_static_stride(
+    camp::idx_t d)
+{
+  camp::idx_t const extents[] = {Extents...};
+  if (extents[d] == 0) {
+    return 0;
+  }
+  camp::idx_t stride = 1;
+  for (camp::idx_t j = d + 1; j < camp::idx_t(sizeof...(Extents)); ++j) {
+    if (extents[j] == dynamic_extent) {
+      return dynamic_extent;
+    }
+    stride *= extents[j] ? extents[j] : 1;
+  }
+  return stride;
+}
+
+
+template <typename IdxLin, typename Range, camp::idx_t... Extents>
+struct MixedLayoutBase_impl;
+
+template <typename IdxLin, camp::idx_t... RangeInts, camp::idx_t... Extents>
+struct MixedLayoutBase_impl<IdxLin, camp::idx_seq<RangeInts...>, Extents...> {
+
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::idx_seq<RangeInts...>;
+  using extents = camp::idx_seq<Extents...>;
+
+  static constexpr size_t n_dims = sizeof...(Extents);
+  static constexpr size_t n_dynamic = RAJA::sum<size_t>(
+      (Extents == dynamic_extent ? size_t(1) : size_t(0))...);
+
+  template <camp::idx_t D>
+  using static_extent =
+      std::integral_constant<camp::idx_t, camp::seq_at<D, extents>::value>;
+
+  template <camp::idx_t D>
+  using static_stride =
+      std::integral_constant<camp::idx_t,
+                             mixed_layout_static_stride<Extents...>(D)>;
+
+  /*!
+   * Runtime sizes in the order of the dynamic extents.
+   */
+  struct DynamicSizes {
+    IdxLin value[n_dynamic > 0 ? n_dynamic : 1];
+  };
+
+  // sizes and strides of all dimensions, including the static ones
+  IdxLin sizes[n_dims];
+  IdxLin strides[n_dims];
+
+  // divisors used by toIndices for the dynamic sizes and strides
+  FastDivisor<IdxLin> inv_strides[n_dims];
+  FastDivisor<IdxLin> inv_mods[n_dims];
+
+
+  /*!
+   * Default constructor, dynamic extents have size zero.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr MixedLayoutBase_impl()
+      : MixedLayoutBase_impl(DynamicSizes{{0}})
+  {
+  }
+
+  /*!
+   * Construct a layout given the sizes of the dynamic extents, in order.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr MixedLayoutBase_impl(Types... ns)
+      : MixedLayoutBase_impl(
+            DynamicSizes{{static_cast<IdxLin>(stripIndexType(ns))...}})
+  {
+    static_assert(n_dynamic == sizeof...(Types),
+                  "number of sizes must match the number of dynamic extents");
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr MixedLayoutBase_impl(
+      DynamicSizes const &dynamic_sizes)
+      : sizes{(static_extent<RangeInts>::value == dynamic_extent
+                   ? dynamic_sizes.value[mixed_layout_dynamic_index<
+                         Extents...>(RangeInts)]
+                   : IdxLin(static_extent<RangeInts>::value))...},
+        strides{(static_stride<RangeInts>::value != dynamic_extent
+                     ? IdxLin(static_stride<RangeInts>::value)
+                     : detail::stride_calculator<RangeInts + 1, n_dims, IdxLin>{}(
+                           IdxLin(1), sizes))...},
+        inv_strides{(strides[RangeInts] ? strides[RangeInts] : IdxLin(1))...},
+        inv_mods{(sizes[RangeInts] ? sizes[RangeInts] : IdxLin(1))...}
+  {
+  }
+
+  /*!
+   * Stride of dimension D, a compile-time constant when all the extents to
+   * its right are static.
+   */
+  template <camp::idx_t D>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin stride() const
+  {
+    return static_stride<D>::value != dynamic_extent
+               ? IdxLin(static_stride<D>::value)
+               : strides[D];
+  }
+
+  /*!
+   * Size of dimension D, a compile-time constant for static extents.
+   */
+  template <camp::idx_t D>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin extent() const
+  {
+    return static_extent<D>::value != dynamic_extent
+               ? IdxLin(static_extent<D>::value)
+               : sizes[D];
+  }
+
+  /*!
+   * Methods to performs bounds checking in layout objects
+   */
+  template <camp::idx_t N, typename Idx>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheckError(Idx idx) const
+  {
+    printf("Error at index %d, value %ld is not within bounds [0, %ld] \n",
+           static_cast<int>(N),
+           static_cast<long int>(idx),
+           static_cast<long int>(sizes[N] - 1));
+    RAJA_ABORT_OR_THROW("Out of bounds error \n");
+  }
+
+  template <camp::idx_t N>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck() const
+  {
+  }
+
+  template <camp::idx_t N, typename Idx, typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck(Idx idx,
+                                                Indices... indices) const
+  {
+    if (sizes[N] > 0 && !(0 <= idx && idx < static_cast<Idx>(sizes[N]))) {
+      BoundsCheckError<N>(idx);
+    }
+    RAJA_UNUSED_VAR(idx);
+    BoundsCheck<N + 1>(indices...);
+  }
+
+  /*!
+   * Computes a linear space index from specified indices.
+   * This is formed by the dot product of the indices and the layout strides,
+   * where the static strides are folded into the products.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE RAJA_BOUNDS_CHECK_constexpr IdxLin operator()(
+      Indices... indices) const
+  {
+    static_assert(n_dims == sizeof...(Indices),
+                  "number of dimensions must match");
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    BoundsCheck<0>(indices...);
+#endif
+    return sum<IdxLin>(
+        (IdxLin(stripIndexType(indices)) * stride<RangeInts>())...);
+  }
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * Divisions by static strides and sizes are by constants, the others use
+   * the reciprocals precomputed at construction (see RAJA::FastDivisor).
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+    static_assert(n_dims == sizeof...(Indices),
+                  "number of dimensions must match");
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    IdxLin totSize = size();
+    if (totSize > 0 && (linear_index < 0 || linear_index >= totSize)) {
+      printf("Error! Linear index %ld is not within bounds [0, %ld]. \n",
+             static_cast<long int>(linear_index),
+             static_cast<long int>(totSize - 1));
+      RAJA_ABORT_OR_THROW("Out of bounds error \n");
+    }
+#endif
+    camp::sink((indices = (camp::decay<Indices>)(
+                    toIndex<RangeInts>(linear_index)))...);
+  }
+
+  /*!
+   * Computes a total size of the layout's space.
+   * This is the product of each dimensions size, where zero-sized static
+   * extents count as one.
+   *
+   * @return Total size spanned by indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return foldl(RAJA::operators::multiplies<IdxLin>(),
+                 (static_extent<RangeInts>::value == 0
+                      ? IdxLin(1)
+                      : extent<RangeInts>())...);
+  }
+
+private:
+  template <camp::idx_t D>
+  RAJA_INLINE RAJA_HOST_DEVICE IdxLin toIndex(IdxLin linear_index) const
+  {
+    using UIdxLin = typename std::make_unsigned<IdxLin>::type;
+
+    IdxLin const quotient =
+        static_stride<D>::value != dynamic_extent
+            ? IdxLin(UIdxLin(linear_index) /
+                     UIdxLin(static_stride<D>::value ? static_stride<D>::value
+                                                     : 1))
+            : linear_index / inv_strides[D];
+
+    return static_extent<D>::value != dynamic_extent
+               ? IdxLin(UIdxLin(quotient) %
+                        UIdxLin(static_extent<D>::value
+                                    ? static_extent<D>::value
+                                    : 1))
+               : quotient % inv_mods[D];
+  }
+};
+
+template <typename IdxLin, camp::idx_t... RangeInts, camp::idx_t... Extents>
+constexpr size_t MixedLayoutBase_impl<IdxLin,
+                                      camp::idx_seq<RangeInts...>,
+                                      Extents...>::n_dims;
+
+template <typename IdxLin, camp::idx_t... RangeInts, camp::idx_t... Extents>
+constexpr size_t MixedLayoutBase_impl<IdxLin,
+                                      camp::idx_seq<RangeInts...>,
+                                      Extents...>::n_dynamic;
+
+}  // namespace detail
+
+
+/*!
+ * @brief A Layout whose extents are each either compile-time or runtime.
+ *
+ * Static extents are given as template arguments and dynamic ones as
+ * RAJA::dynamic_extent, with their sizes passed to the constructor in
+ * order.  As in Layout, the right-most index has stride one.  The stride
+ * of each dimension whose right-hand extents are all static is a
+ * compile-time constant, so the index arithmetic for small fixed inner
+ * dimensions folds into constant multiplies:
+ *
+ *     // nelem runtime elements of 27 quadrature points x 3 components
+ *     MixedLayout<dynamic_extent, 27, 3> layout(nelem);
+ *
+ *     RAJA::View<double, MixedLayout<dynamic_extent, 27, 3>> v(ptr, layout);
+ *     v(e, q, c) = 0.0;   // ptr[e * 81 + q * 3 + c]
+ *
+ * Zero-sized static extents are projections, as in Layout; a dynamic
+ * extent of size zero is an empty dimension.
+ */
+template <typename IdxLin, camp::idx_t... Extents>
+using MixedLayoutT =
+    detail::MixedLayoutBase_impl<IdxLin,
+                                 camp::make_idx_seq_t<sizeof...(Extents)>,
+                                 Extents...>;
+
+template <camp::idx_t... Extents>
+using MixedLayout = MixedLayoutT<Index_type, Extents...>;
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,326 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining MortonLayout, a N-dimensional index
+ *          calculator that orders indices along a Morton (Z-order) curve
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_MORTONLAYOUT_HPP
+#define RAJA_MORTONLAYOUT_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <type_traits>
+
+#if defined(__BMI2__) && !defined(__CUDA_ARCH__) && \
+    !defined(__HIP_DEVICE_COMPILE__)
+#include <immintrin.h>
+#define RAJA_CURVE_USE_BMI2
+#endif
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/internal/foldl.hpp"
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * Scatter the low-order bits of value into the bit positions set in mask,
+ * lowest to highest (x86 BMI2 "pdep").
+ */
+RAJA_INLINE RAJA_HOST_DEVICE uint64_t bit_deposit(uint64_t value,
+                                                  uint64_t mask)
+{
+#if defined(RAJA_CURVE_USE_BMI2)
+  return _pdep_u64(value, mask);
+#else
+  uint64_t result = 0;
+  for (uint64_t bit = 1; mask; bit += bit) {
+    if (value & bit) {
+      result |= mask & (~mask + 1);
+    }
+    mask &= mask - 1;
+  }
+  return result;
+#endif
+}
+
+/*!
+ * Gather the bits of value found at the bit positions set in mask into the
+ * low-order bits of the result (x86 BMI2 "pext").
+ */
+RAJA_INLINE RAJA_HOST_DEVICE uint64_t bit_extract(uint64_t value,
+                                                  uint64_t mask)
+{
+#if defined(RAJA_CURVE_USE_BMI2)
+  return _pext_u64(value, mask);
+#else
+  uint64_t result = 0;
+  for (uint64_t bit = 1; mask; bit += bit) {
+    if (value & mask & (~mask + 1)) {
+      result |= bit;
+    }
+    mask &= mask - 1;
+  }
+  return result;
+#endif
+}
+
+/*!
+ * Number of bits needed to represent the indices [0, size) of one dimension
+ * of a space-filling curve.  Zero-sized dimensions are treated as size 1.
+ */
+RAJA_INLINE RAJA_HOST_DEVICE int curve_bits(Index_type size)
+{
+  int bits = 0;
+  while ((Index_type(1) << bits) < size) {
+    ++bits;
+  }
+  return bits;
+}
+
+
+template <typename Range, typename IdxLin = Index_type>
+struct MortonLayout_impl;
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+struct MortonLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> {
+public:
+  using IndexLinear = IdxLin;
+  using IndexRange = camp::make_idx_seq_t<sizeof...(RangeInts)>;
+
+  static constexpr size_t n_dims = sizeof...(RangeInts);
+
+  IdxLin sizes[n_dims];
+  uint64_t masks[n_dims];
+  int num_bits;
+
+
+  /*!
+   * Default constructor with zero sizes.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr MortonLayout_impl()
+      : sizes{0}, masks{0}, num_bits{0}
+  {
+  }
+
+  /*!
+   * Construct a layout given the size of each dimension.
+   *
+   * Each dimension is padded to the next power of two, and the bits of the
+   * indices are interleaved from least to most significant, with the
+   * right-most index occupying the lowest bit of each group.  Dimensions
+   * that need fewer bits drop out of the interleaving once exhausted, so
+   * the padding is per-dimension rather than to a common cube.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE MortonLayout_impl(Types... ns)
+      : sizes{static_cast<IdxLin>(stripIndexType(ns))...},
+        masks{((void)RangeInts, uint64_t(0))...},
+        num_bits{0}
+  {
+    static_assert(n_dims == sizeof...(Types),
+                  "number of dimensions must match");
+
+    int bits[n_dims] = {curve_bits(sizes[RangeInts])...};
+    int max_bits = RAJA::max<int>(bits[RangeInts]...);
+
+    for (int b = 0; b < max_bits; ++b) {
+      for (int d = static_cast<int>(n_dims) - 1; d >= 0; --d) {
+        if (b < bits[d]) {
+          masks[d] |= uint64_t(1) << num_bits;
+          ++num_bits;
+        }
+      }
+    }
+
+    if (num_bits >= static_cast<int>(8 * sizeof(IdxLin)) - 1) {
+      RAJA_ABORT_OR_THROW("MortonLayout: index space too large for IdxLin");
+    }
+  }
+
+  /*!
+   * Methods to performs bounds checking in layout objects
+   */
+  template <camp::idx_t N, typename Idx>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheckError(Idx idx) const
+  {
+    printf("Error at index %d, value %ld is not within bounds [0, %ld] \n",
+           static_cast<int>(N),
+           static_cast<long int>(idx),
+           static_cast<long int>(sizes[N] - 1));
+    RAJA_ABORT_OR_THROW("Out of bounds error \n");
+  }
+
+  template <camp::idx_t N>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck() const
+  {
+  }
+
+  template <camp::idx_t N, typename Idx, typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void BoundsCheck(Idx idx,
+                                                Indices... indices) const
+  {
+    if (sizes[N] > 0 && !(0 <= idx && idx < static_cast<Idx>(sizes[N]))) {
+      BoundsCheckError<N>(idx);
+    }
+    RAJA_UNUSED_VAR(idx);
+    BoundsCheck<N + 1>(indices...);
+  }
+
+  /*!
+   * Computes a linear space index from specified indices.
+   * This is formed by interleaving the bits of the indices.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE IdxLin operator()(Indices... indices) const
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    BoundsCheck<0>(indices...);
+#endif
+    // the masks are disjoint, so the sum is a bitwise or
+    return static_cast<IdxLin>(sum<uint64_t>(bit_deposit(
+        static_cast<uint64_t>(stripIndexType(indices)), masks[RangeInts])...));
+  }
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * This is one bit-extract per dimension (a single pext instruction each
+   * when compiled with BMI2 support).
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+    camp::sink((indices = (camp::decay<Indices>)bit_extract(
+                    static_cast<uint64_t>(linear_index), masks[RangeInts]))...);
+  }
+
+  /*!
+   * Array form of toIndices, used by curve-ordered iteration.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndexArray(
+      IdxLin linear_index,
+      IdxLin (&indices)[n_dims]) const
+  {
+    camp::sink((indices[RangeInts] = static_cast<IdxLin>(bit_extract(
+                    static_cast<uint64_t>(linear_index), masks[RangeInts])))...);
+  }
+
+  /*!
+   * Returns true if indices lie within the (unpadded) sizes of this layout.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE bool inBounds(
+      IdxLin const (&indices)[n_dims]) const
+  {
+    return foldl(RAJA::operators::logical_and<bool>(),
+                 (indices[RangeInts] < (sizes[RangeInts] ? sizes[RangeInts]
+                                                         : IdxLin(1)))...);
+  }
+
+  /*!
+   * Given a linear index whose indices lie outside of the sizes of this
+   * layout, return the number of consecutive linear indices that can be
+   * skipped since they also lie outside.
+   *
+   * Any block of linear indices aligned to a power of two spans the
+   * indices above those of its first element, so the whole block is out of
+   * bounds whenever its first element is.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE IdxLin skipLength(
+      IdxLin linear_index,
+      IdxLin const (&)[n_dims]) const
+  {
+    IdxLin block = linear_index ? (linear_index & (-linear_index)) : size();
+    IdxLin remaining = size() - linear_index;
+    return block < remaining ? block : remaining;
+  }
+
+  /*!
+   * Computes a total size of the layout's space, including the padding of
+   * each dimension to a power of two.
+   *
+   * @return Total size spanned by indices
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin size() const
+  {
+    return IdxLin(1) << num_bits;
+  }
+};
+
+template <camp::idx_t... RangeInts, typename IdxLin>
+constexpr size_t
+    MortonLayout_impl<camp::idx_seq<RangeInts...>, IdxLin>::n_dims;
+
+}  // namespace detail
+
+/*!
+ * @brief A mapping of n-dimensional index space to a linear index space that
+ * follows a Morton (Z-order) space-filling curve.
+ *
+ * Neighboring indices in any dimension tend to be close in the linear
+ * space, which gives locality in all dimensions at once for stencil-like
+ * access patterns where no single stride ordering works well.
+ *
+ * For example:
+ *
+ *     // Create a layout object
+ *     MortonLayout<3> layout(64, 64, 64);
+ *
+ *     // Allocate for the padded index space
+ *     double *data = new double[layout.size()];
+ *
+ *     View<double, MortonLayout<3>> view(data, layout);
+ *
+ * Sizes that are not powers of two are padded up, per dimension, so
+ * layout.size() may be larger than the product of the sizes.
+ *
+ * See RAJA::morton_collapse_exec for a kernel policy that iterates over
+ * indices in Morton order.
+ */
+template <size_t n_dims, typename IdxLin = Index_type>
+using MortonLayout =
+    detail::MortonLayout_impl<camp::make_idx_seq_t<n_dims>, IdxLin>;
+
+template <typename LayoutType>
+struct is_affine_layout;
+
+// lanes of a VectorIndex are not equally spaced along the curve
+template <camp::idx_t... RangeInts, typename IdxLin>
+struct is_affine_layout<
+    detail::MortonLayout_impl<camp::idx_seq<RangeInts...>, IdxLin>>
+    : std::false_type {
+};
+
+}  // namespace RAJA
+
+#endif
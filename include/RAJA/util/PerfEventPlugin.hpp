@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Perf_Event_Plugin_HPP
+#define RAJA_Perf_Event_Plugin_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginReport.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * Plugin that reads Linux perf_event hardware counters around every
+   * kernel launch and collects them per kernel name and policy.
+   *
+   * The plugin is only active when the environment variable
+   * RAJA_PERF_EVENTS names a report file, which finalize_plugins() writes
+   * as JSON if its name ends in ".json" and as CSV otherwise.
+   * RAJA_PERF_COUNTERS is a comma separated list of the counters to read,
+   * from cycles, instructions, cache-references, cache-misses,
+   * branch-misses, LLC-loads, LLC-load-misses, LLC-stores and
+   * LLC-store-misses; the default is cycles, instructions,
+   * cache-references and cache-misses.
+   *
+   * By default a launch counts the launching thread only, reading a
+   * counter group of its own without taking a lock.  If the environment
+   * variable RAJA_PERF_ALL_THREADS is set, every thread of the process has
+   * a counter group, opened from the launching thread with the thread's id,
+   * and a launch counts the work of all threads, such as the OpenMP or TBB
+   * workers of a parallel loop, unless another launch was in progress when
+   * it started.  Listing and reading the threads costs a scan of
+   * /proc/self/task and a read per thread under a lock at the start and end
+   * of every such launch, and it counts threads unrelated to the launch as
+   * well.  Nested launches and launches from several threads at once count
+   * the launching thread only; the report gives how many launches were
+   * counted that way.  Threads created during a launch, such as the OpenMP
+   * thread pool on the first parallel launch, are counted from the next
+   * launch on.  The report derives
+   * instructions per cycle, the cache miss rate and the DRAM bytes as
+   * last level cache misses times the cache line size.  Where perf events
+   * are unavailable the plugin prints a warning once and only counts
+   * launches.
+   */
+  class PerfEventPlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    struct KernelCounters {
+      std::string kernel_name;
+      std::string policy_name;
+      std::size_t calls = 0;
+      //! Number of the calls for which the counters were read
+      std::size_t measured = 0;
+      //! Number of the measured calls counted on the launching thread only
+      std::size_t thread_only = 0;
+      std::vector<uint64_t> counts;
+
+      //! Derived metrics, or a negative value if the counters were not read
+      double ipc = -1.0;
+      double cache_miss_rate = -1.0;
+      double dram_bytes = -1.0;
+    };
+
+    PerfEventPlugin();
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! Names of the counters in KernelCounters::counts
+    const std::vector<std::string>& getCounterNames() const
+    {
+      return m_names;
+    }
+
+    //! The counters collected so far, sorted by decreasing first counter
+    std::vector<KernelCounters> getCounters() const;
+
+    void writeCSV(std::ostream& os) const;
+
+    void writeJSON(std::ostream& os) const;
+
+  private:
+    void record(const PluginContext& p,
+                const std::vector<uint64_t>& counts,
+                bool thread_only);
+
+    std::string m_path;
+    std::vector<std::string> m_names;
+    std::vector<std::pair<uint32_t, uint64_t>> m_events;
+    bool m_all_threads = false;
+
+    detail::KernelReport<KernelCounters> m_counters;
+
+  };  // end PerfEventPlugin class
+
+  void linkPerfEventPlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
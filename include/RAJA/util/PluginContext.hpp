@@ -8,21 +8,116 @@
 #ifndef RAJA_plugin_context_HPP
 #define RAJA_plugin_context_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <typeinfo>
+
+#include "RAJA/config.hpp"
+
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/internal/get_platform.hpp"
 
 namespace RAJA {
+
+/*!
+ * Bytes of memory read and written and floating point operations per
+ * iterate of a kernel, from which plugins derive the achieved bandwidth
+ * and flop rate.  Zero if not given.
+ */
+struct Roofline {
+  double bytes_read;
+  double bytes_written;
+  double flops;
+};
+
+/*!
+ * Name of a kernel, passed to the plugins in PluginContext::kernel_name,
+ * optionally with its Roofline data in PluginContext::roofline.
+ *
+ *   RAJA::forall<RAJA::seq_exec>(RAJA::Name("daxpy"), range, body);
+ *
+ *   // y[i] += a * x[i] reads 16 bytes, writes 8 bytes and does 2 flops
+ *   RAJA::forall<RAJA::seq_exec>(
+ *       RAJA::Name("daxpy", RAJA::Roofline{16, 8, 2}), range, body);
+ *
+ * The string is not copied and must outlive the kernel.
+ */
+struct Name {
+  constexpr Name() : name(nullptr), roofline{0, 0, 0} {}
+  explicit constexpr Name(const char* n) : name(n), roofline{0, 0, 0} {}
+  constexpr Name(const char* n, Roofline r) : name(n), roofline(r) {}
+
+  const char* name;
+  Roofline roofline;
+};
+
 namespace util {
 
 class KokkosPluginLoader;
 
+namespace detail {
+
+//! Extracts the name of T from "... [with T = name; ...]" (gcc) or
+//! "... [T = name]" (clang)
+inline std::string type_name_from_signature(const std::string& func)
+{
+  std::string::size_type begin = func.find("T = ");
+  if (begin == std::string::npos) return func;
+  begin += 4;
+  return func.substr(begin, func.find_first_of(";]", begin) - begin);
+}
+
+//! Name of the type T as spelled by the compiler, computed once.
+template<typename T>
+struct type_name {
+  static const char* const value;
+
+private:
+  static const char* get()
+  {
+#if defined(__clang__) || defined(__GNUC__)
+    static const std::string name =
+        type_name_from_signature(__PRETTY_FUNCTION__);
+    return name.c_str();
+#else
+    return typeid(T).name();
+#endif
+  }
+};
+
+template<typename T>
+const char* const type_name<T>::value = type_name<T>::get();
+
+} // closing brace for detail namespace
+
 struct PluginContext {
   public:
-    PluginContext(const Platform p) :
-      platform(p) {}
+    PluginContext(const Platform p,
+                  const char* name = nullptr,
+                  std::size_t iterations = 0,
+                  const char* policy = nullptr,
+                  Roofline r = Roofline{0, 0, 0}) :
+      platform(p),
+      kernel_name(name),
+      num_iterations(iterations),
+      policy_name(policy),
+      roofline(r) {}
 
     Platform platform;
 
+    //! Name given to the kernel with RAJA::Name, or nullptr
+    const char* kernel_name;
+
+    //! Number of iterates of the kernel, or 0 if unknown
+    std::size_t num_iterations;
+
+    //! Name of the execution policy type, or nullptr if unknown
+    const char* policy_name;
+
+    //! Roofline data given to the kernel with RAJA::Name
+    Roofline roofline;
+
   private:
     mutable uint64_t kID;
 
@@ -30,9 +125,21 @@ struct PluginContext {
 };
 
 template<typename Policy>
-PluginContext make_context()
+PluginContext make_context(Name name = Name(), std::size_t num_iterations = 0)
 {
-  return PluginContext{detail::get_platform<Policy>::value};
+#if defined(RAJA_ENABLE_PLUGINS)
+  return PluginContext{detail::get_platform<Policy>::value,
+                       name.name,
+                       num_iterations,
+                       detail::type_name<Policy>::value,
+                       name.roofline};
+#else
+  return PluginContext{detail::get_platform<Policy>::value,
+                       name.name,
+                       num_iterations,
+                       nullptr,
+                       name.roofline};
+#endif
 }
 
 } // closing brace for util namespace
@@ -10,6 +10,11 @@
 
 #include "RAJA/util/RuntimePluginLoader.hpp"
 #include "RAJA/util/KokkosPluginLoader.hpp"
+#include "RAJA/util/LoadBalancePlugin.hpp"
+#include "RAJA/util/PerfEventPlugin.hpp"
+#include "RAJA/util/RooflinePlugin.hpp"
+#include "RAJA/util/StatsPlugin.hpp"
+#include "RAJA/util/TracePlugin.hpp"
 
 namespace {
   namespace anonymous_RAJA {
@@ -17,6 +22,11 @@ namespace {
       inline pluginLinker() {
         (void)RAJA::util::linkRuntimePluginLoader();
         (void)RAJA::util::linkKokkosPluginLoader();
+        (void)RAJA::util::linkStatsPlugin();
+        (void)RAJA::util::linkTracePlugin();
+        (void)RAJA::util::linkPerfEventPlugin();
+        (void)RAJA::util::linkRooflinePlugin();
+        (void)RAJA::util::linkLoadBalancePlugin();
       }
     } pluginLinker;
   }
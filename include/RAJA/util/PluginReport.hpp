@@ -0,0 +1,192 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Plugin_Report_HPP
+#define RAJA_Plugin_Report_HPP
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace RAJA {
+namespace util {
+namespace detail {
+
+//! Helpers for the plugins that write reports
+
+inline bool hasSuffix(const std::string& str, const std::string& suffix)
+{
+  return str.size() >= suffix.size() &&
+         !str.compare(str.size() - suffix.size(), suffix.size(), suffix);
+}
+
+inline std::string quoteCSV(const std::string& str)
+{
+  std::string quoted("\"");
+  for (char c : str) {
+    if (c == '"') quoted += '"';
+    quoted += c;
+  }
+  return quoted + '"';
+}
+
+inline std::string quoteJSON(const std::string& str)
+{
+  std::string quoted("\"");
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      quoted += '\\';
+      quoted += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+      quoted += escaped;
+    } else {
+      quoted += c;
+    }
+  }
+  return quoted + '"';
+}
+
+/*!
+ * Writes the report of plugin to path, as JSON with plugin.writeJSON if the
+ * path ends in ".json" and as CSV with plugin.writeCSV otherwise.
+ */
+template <typename Plugin>
+void writeReport(Plugin& plugin,
+                 const char* plugin_name,
+                 const std::string& path)
+{
+  std::ofstream report(path);
+  if (!report)
+  {
+    printf("[%s]: Could not open report file %s\n", plugin_name, path.c_str());
+  }
+  else if (hasSuffix(path, ".json"))
+  {
+    plugin.writeJSON(report);
+  }
+  else
+  {
+    plugin.writeCSV(report);
+  }
+}
+
+//! The kernel name and policy name that a report entry is collected for
+using KernelKey = std::pair<std::string, std::string>;
+
+inline KernelKey kernelKey(const char* kernel_name, const char* policy_name)
+{
+  return KernelKey(kernel_name ? kernel_name : "",
+                   policy_name ? policy_name : "");
+}
+
+//! The entries of a report, sorted stably so that comes_before(a, b) holds
+//! for each entry a before an entry b it is not equivalent to
+template <typename Entry, typename Compare>
+std::vector<Entry> sortedEntries(std::map<KernelKey, Entry> const& entries,
+                                 Compare comes_before)
+{
+  std::vector<Entry> sorted;
+  sorted.reserve(entries.size());
+  for (auto const& entry : entries) {
+    sorted.push_back(entry.second);
+  }
+  std::stable_sort(sorted.begin(), sorted.end(), comes_before);
+  return sorted;
+}
+
+/*!
+ * The entries of a report by kernel name and policy name, shared by the
+ * launching threads.  Entry has std::string members kernel_name and
+ * policy_name, which are set when the entry is created.
+ */
+template <typename Entry>
+class KernelReport
+{
+public:
+  //! Calls update(entry) on the entry of the kernel with the lock held
+  template <typename Update>
+  void update(const char* kernel_name, const char* policy_name, Update&& update)
+  {
+    KernelKey key = kernelKey(kernel_name, policy_name);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+    {
+      it = m_entries.emplace(key, Entry{}).first;
+      it->second.kernel_name = key.first;
+      it->second.policy_name = key.second;
+    }
+    update(it->second);
+  }
+
+  //! The entries collected so far, see sortedEntries
+  template <typename Compare>
+  std::vector<Entry> sorted(Compare comes_before) const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return sortedEntries(m_entries, comes_before);
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+  }
+
+private:
+  mutable std::mutex m_mutex;
+  std::map<KernelKey, Entry> m_entries;
+};
+
+/*!
+ * Copies of the kernel names seen by one thread, since RAJA::Name strings
+ * only have to outlive their kernel.  Names are looked up by address, so
+ * a name that was seen before is not copied again.
+ */
+class NameTable
+{
+public:
+  //! Returns the copy of name, which lives as long as the table
+  const char* intern(const char* name)
+  {
+    if (nullptr == name) return nullptr;
+
+    // the same address may hold another name by now, e.g. a reused buffer
+    auto copy = m_copies.find(name);
+    if (copy != m_copies.end() && 0 == strcmp(copy->second, name))
+    {
+      return copy->second;
+    }
+
+    const char* interned = m_names.insert(name).first->c_str();
+    m_copies[name] = interned;
+    return interned;
+  }
+
+private:
+  std::unordered_set<std::string> m_names;
+  //! The copy made for the name last seen at each address
+  std::unordered_map<const char*, const char*> m_copies;
+};
+
+} // closing brace for detail namespace
+} // closing brace for util namespace
+} // closing brace for RAJA namespace
+
+#endif
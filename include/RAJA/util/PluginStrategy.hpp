@@ -8,19 +8,27 @@
 #ifndef RAJA_PluginStrategy_HPP
 #define RAJA_PluginStrategy_HPP
 
+#include <atomic>
+
 #include "RAJA/util/PluginContext.hpp"
 #include "RAJA/util/PluginOptions.hpp"
 #include "RAJA/util/Registry.hpp"
+#include "RAJA/util/macros.hpp"
 
 namespace RAJA {
 namespace util {
 
+/*!
+ * Number of plugins that are called by the RAJA loops, see plugins_active().
+ */
+extern std::atomic<int> active_plugin_count;
+
 class PluginStrategy
 {
   public:
     PluginStrategy();
 
-    virtual ~PluginStrategy() = default;
+    virtual ~PluginStrategy();
 
     virtual void init(const PluginOptions& p);
 
@@ -33,10 +41,32 @@ class PluginStrategy
     virtual void postLaunch(const PluginContext& p);
 
     virtual void finalize();
+
+  protected:
+    /*!
+     * Sets whether this plugin counts toward plugins_active().  Plugins are
+     * active when constructed; plugins that only forward to other plugins,
+     * like the plugin loaders, deactivate themselves while they are empty.
+     */
+    void setActive(bool active);
+
+  private:
+    bool m_active;
 };
 
 using PluginRegistry = Registry<PluginStrategy>;
 
+/*!
+ * True if any plugin is active, so the loops call the plugins only when
+ * there is something to call.
+ */
+RAJA_INLINE
+bool
+plugins_active()
+{
+  return active_plugin_count.load(std::memory_order_relaxed) != 0;
+}
+
 } // closing brace for util namespace
 } // closing brace for RAJA namespace
 
@@ -0,0 +1,278 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining reduced-precision storage types and a
+ *          View pointer type that converts on load and store.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_REDUCED_PRECISION_HPP
+#define RAJA_REDUCED_PRECISION_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include "RAJA/index/IndexValue.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+RAJA_HOST_DEVICE RAJA_INLINE uint32_t float_to_bits(float f)
+{
+  uint32_t u;
+  memcpy(&u, &f, sizeof(u));
+  return u;
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE float bits_to_float(uint32_t u)
+{
+  float f;
+  memcpy(&f, &u, sizeof(f));
+  return f;
+}
+
+/*!
+ * Returns a if cond, else b, with masks so that compilers emit blends rather
+ * than branches.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE uint32_t select_bits(bool cond,
+                                                  uint32_t a,
+                                                  uint32_t b)
+{
+  uint32_t const mask = 0u - static_cast<uint32_t>(cond);
+  return (a & mask) | (b & ~mask);
+}
+
+/*!
+ * Rounds a float to the nearest bfloat16, ties to even; NaNs stay quiet
+ * NaNs.  Branch free, so loops of conversions vectorize.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE uint16_t float_to_bfloat16_bits(float f)
+{
+  uint32_t const u = float_to_bits(f);
+  uint32_t const rounded = (u + 0x7fffu + ((u >> 16) & 1u)) >> 16;
+  uint32_t const quiet_nan = (u >> 16) | 0x40u;
+  return static_cast<uint16_t>(
+      select_bits((u & 0x7fffffffu) > 0x7f800000u, quiet_nan, rounded));
+}
+
+RAJA_HOST_DEVICE RAJA_INLINE float bfloat16_bits_to_float(uint16_t b)
+{
+  return bits_to_float(static_cast<uint32_t>(b) << 16);
+}
+
+/*!
+ * Rounds a float to the nearest IEEE binary16, ties to even, overflowing to
+ * infinity; NaNs stay quiet NaNs.
+ *
+ * All cases are computed and then selected, so loops of conversions
+ * vectorize without F16C or AVX-512 FP16 support.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE uint16_t float_to_float16_bits(float f)
+{
+  uint32_t const f32_infinity = 255u << 23;
+  uint32_t const f16_max = (127u + 16u) << 23;
+  uint32_t const denorm_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+  uint32_t u = float_to_bits(f);
+  uint32_t const sign = u & 0x80000000u;
+  u ^= sign;
+
+  // infinity or NaN
+  uint32_t const inf_nan = (u > f32_infinity) ? 0x7e00u : 0x7c00u;
+
+  // subnormal or zero, the float addition does the rounding
+  uint32_t const subnormal =
+      float_to_bits(bits_to_float(u) + bits_to_float(denorm_magic)) -
+      denorm_magic;
+
+  // normal, rebias the exponent and round the mantissa
+  uint32_t const normal =
+      (u + ((15u - 127u) << 23) + 0xfffu + ((u >> 13) & 1u)) >> 13;
+
+  uint32_t const o = select_bits(
+      u >= f16_max, inf_nan, select_bits(u < (113u << 23), subnormal, normal));
+  return static_cast<uint16_t>(o | (sign >> 16));
+}
+
+/*!
+ * Converts an IEEE binary16 to float, exactly.
+ */
+RAJA_HOST_DEVICE RAJA_INLINE float float16_bits_to_float(uint16_t b)
+{
+  uint32_t const shifted_exp = 0x7c00u << 13;
+
+  uint32_t const o = ((static_cast<uint32_t>(b) & 0x7fffu) << 13) +
+                     ((127u - 15u) << 23);
+  uint32_t const exp = shifted_exp & (o - ((127u - 15u) << 23));
+
+  // infinity or NaN
+  uint32_t const inf_nan = o + ((128u - 16u) << 23);
+
+  // zero or subnormal, renormalize
+  uint32_t const subnormal = float_to_bits(bits_to_float(o + (1u << 23)) -
+                                           bits_to_float(113u << 23));
+
+  uint32_t const r = select_bits(
+      exp == shifted_exp, inf_nan, select_bits(exp == 0, subnormal, o));
+  return bits_to_float(r | ((static_cast<uint32_t>(b) & 0x8000u) << 16));
+}
+
+}  // namespace detail
+
+
+/*!
+ * @brief 16-bit brain floating point storage type.
+ *
+ * Has the exponent range of float with 8 bits of precision.  Intended for
+ * storage only: it converts to float, where arithmetic is done.
+ */
+struct bfloat16 {
+  uint16_t bits;
+
+  bfloat16() = default;
+
+  RAJA_HOST_DEVICE RAJA_INLINE explicit bfloat16(float f)
+      : bits{detail::float_to_bfloat16_bits(f)}
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator float() const
+  {
+    return detail::bfloat16_bits_to_float(bits);
+  }
+};
+
+/*!
+ * @brief IEEE 754 binary16 storage type.
+ *
+ * Has 11 bits of precision and a largest finite value of 65504.  Intended
+ * for storage only: it converts to float, where arithmetic is done.
+ */
+struct float16 {
+  uint16_t bits;
+
+  float16() = default;
+
+  RAJA_HOST_DEVICE RAJA_INLINE explicit float16(float f)
+      : bits{detail::float_to_float16_bits(f)}
+  {
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator float() const
+  {
+    return detail::float16_bits_to_float(bits);
+  }
+};
+
+
+/*!
+ * @brief Reference to a StorageType value that is read and written as a
+ * ValueType.
+ *
+ * Conversions use static_cast, so a double stored as bfloat16 or float16 is
+ * first rounded to float.
+ */
+template <typename ValueType, typename StorageType>
+struct ConvertingRef {
+  using value_type = ValueType;
+  using storage_type = StorageType;
+
+  storage_type *ptr;
+
+  RAJA_HOST_DEVICE RAJA_INLINE operator value_type() const
+  {
+    return static_cast<value_type>(*ptr);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertingRef const &operator=(
+      value_type val) const
+  {
+    *ptr = static_cast<storage_type>(val);
+    return *this;
+  }
+
+  // assigning from another reference assigns the value
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertingRef const &operator=(
+      ConvertingRef const &rhs) const
+  {
+    return *this = static_cast<value_type>(rhs);
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertingRef const &operator+=(
+      value_type val) const
+  {
+    return *this = static_cast<value_type>(*this) + val;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertingRef const &operator-=(
+      value_type val) const
+  {
+    return *this = static_cast<value_type>(*this) - val;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertingRef const &operator*=(
+      value_type val) const
+  {
+    return *this = static_cast<value_type>(*this) * val;
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE ConvertingRef const &operator/=(
+      value_type val) const
+  {
+    return *this = static_cast<value_type>(*this) / val;
+  }
+};
+
+/*!
+ * @brief Pointer to StorageType data accessed as ValueType, for use as the
+ * PointerType of a View.
+ *
+ * Indexing returns a ConvertingRef that converts on load and store.  The
+ * conversions are inlined and branch free for float, bfloat16 and float16,
+ * so they vectorize in simd_exec loops.
+ */
+template <typename ValueType, typename StorageType>
+struct ConvertingPtr {
+  using value_type = ValueType;
+  using storage_type = StorageType;
+  using reference = ConvertingRef<ValueType, StorageType>;
+
+  storage_type *ptr;
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr ConvertingPtr() : ptr{nullptr} {}
+
+  RAJA_HOST_DEVICE RAJA_INLINE constexpr ConvertingPtr(storage_type *p)
+      : ptr{p}
+  {
+  }
+
+  template <typename Idx>
+  RAJA_HOST_DEVICE RAJA_INLINE reference operator[](Idx i) const
+  {
+    return reference{ptr + stripIndexType(i)};
+  }
+
+  RAJA_HOST_DEVICE RAJA_INLINE storage_type *get() const { return ptr; }
+};
+
+}  // namespace RAJA
+
+#endif /* RAJA_REDUCED_PRECISION_HPP */
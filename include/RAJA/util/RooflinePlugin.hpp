@@ -0,0 +1,86 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Roofline_Plugin_HPP
+#define RAJA_Roofline_Plugin_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginReport.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * Plugin that times the kernels launched with a RAJA::Name carrying
+   * Roofline data and reports, per kernel name and policy, the achieved
+   * bandwidth and flop rate, and the bandwidth as a percentage of the
+   * host's STREAM triad bandwidth.
+   *
+   * The plugin is only active when the environment variable RAJA_ROOFLINE
+   * names a report file.  finalize_plugins() measures the STREAM triad
+   * bandwidth, unless RAJA_ROOFLINE_PEAK gives it in GB/s, and writes the
+   * report sorted by total time, as JSON if the file name ends in ".json"
+   * and as CSV otherwise.
+   */
+  class RooflinePlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    struct KernelRoofline {
+      std::string kernel_name;
+      std::string policy_name;
+      std::size_t calls = 0;
+      double time = 0.0;
+      double bytes = 0.0;
+      double flops = 0.0;
+
+      double intensity() const { return bytes > 0.0 ? flops / bytes : 0.0; }
+      double bandwidth() const { return time > 0.0 ? bytes / time : 0.0; }
+      double flop_rate() const { return time > 0.0 ? flops / time : 0.0; }
+    };
+
+    RooflinePlugin();
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! The kernels timed so far, sorted by decreasing total time
+    std::vector<KernelRoofline> getKernels() const;
+
+    //! STREAM triad bandwidth of the host in bytes per second
+    double getPeakBandwidth();
+
+    void writeCSV(std::ostream& os);
+
+    void writeJSON(std::ostream& os);
+
+  private:
+    std::string m_path;
+    double m_peak_bandwidth;
+
+    detail::KernelReport<KernelRoofline> m_kernels;
+
+  };  // end RooflinePlugin class
+
+  //! Best bandwidth in bytes per second of a STREAM triad over arrays of
+  //! num_elements doubles
+  double measure_stream_triad(std::size_t num_elements, int repeats);
+
+  void linkRooflinePlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -44,6 +44,15 @@ public:
   RAJA_HOST_DEVICE value_type get(size_t i) const { return mem[i]; }
   RAJA_HOST_DEVICE void set(size_t i, value_type val) { mem[i] = val; }
 
+  RAJA_HOST_DEVICE value_type& operator[](size_t i) { return mem[i]; }
+  RAJA_HOST_DEVICE value_type const& operator[](size_t i) const
+  {
+    return mem[i];
+  }
+
+  RAJA_HOST_DEVICE value_type* data() { return mem; }
+  RAJA_HOST_DEVICE value_type const* data() const { return mem; }
+
 private:
   value_type mem[size];
 };
@@ -23,6 +23,7 @@
 
 #include <iostream>
 #include <limits>
+#include <type_traits>
 
 #include "RAJA/index/IndexValue.hpp"
 
@@ -94,6 +95,33 @@ struct StaticLayoutBase_impl<IdxLin,
   }
 
 
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * The strides and sizes are compile-time constants, so compilers replace
+   * the divisions with multiply-and-shift sequences, as Layout does at
+   * runtime with RAJA::FastDivisor.  Division is done in the unsigned type
+   * to avoid the fix-ups needed for negative numerators.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  static RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                                     Indices &&... indices)
+  {
+    static_assert(sizeof...(Indices) == sizeof...(Sizes),
+                  "number of dimensions must match");
+    using UIdxLin = typename std::make_unsigned<IdxLin>::type;
+    camp::sink((indices = (camp::decay<Indices>)(
+                    (UIdxLin(linear_index) /
+                     UIdxLin(Strides ? Strides : IdxLin(1))) %
+                    UIdxLin(Sizes ? Sizes : IdxLin(1))))...);
+  }
+
+
   static constexpr IdxLin s_size =
       RAJA::product<IdxLin>((Sizes == IdxLin(0) ? IdxLin(1) : Sizes)...);
 
@@ -0,0 +1,100 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Stats_Plugin_HPP
+#define RAJA_Stats_Plugin_HPP
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginReport.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * Plugin that times every kernel launch and collects, per kernel name and
+   * policy, the number of launches, the total, min, max and mean time in
+   * seconds, and the total number of iterates.
+   *
+   * The plugin is only active when the environment variable RAJA_STATS
+   * names a report file.  finalize_plugins() writes the report, sorted by
+   * total time, as JSON if the file name ends in ".json" and as CSV
+   * otherwise.
+   *
+   * Each thread collects the statistics of its own launches, keyed by the
+   * addresses of the names, and getStats() merges them per name.
+   *
+   * Launches are timed on the host, so the times of asynchronous device
+   * kernels are only their launch times.
+   */
+  class StatsPlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    struct KernelStats {
+      std::string kernel_name;
+      std::string policy_name;
+      std::size_t calls = 0;
+      double total_time = 0.0;
+      double min_time = 0.0;
+      double max_time = 0.0;
+      std::size_t iterations = 0;
+
+      double mean_time() const { return calls ? total_time / calls : 0.0; }
+    };
+
+    StatsPlugin();
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! The statistics collected so far, sorted by decreasing total time
+    std::vector<KernelStats> getStats() const;
+
+    void writeCSV(std::ostream& os) const;
+
+    void writeJSON(std::ostream& os) const;
+
+  private:
+    //! The statistics of the launches of one thread
+    struct ThreadStats {
+      //! Only contended while the statistics are merged or cleared
+      std::mutex mutex;
+      //! Copies of the kernel names of the launches
+      detail::NameTable names;
+      //! Statistics by kernel name copy and policy name
+      std::map<std::pair<const char*, const char*>, KernelStats> stats;
+    };
+
+    ThreadStats& getThreadStats();
+
+    void record(const PluginContext& p, double time);
+
+    std::string m_path;
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<ThreadStats>> m_threads;
+
+  };  // end StatsPlugin class
+
+  void linkStatsPlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -0,0 +1,73 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file for the per-thread load of parallel host loops.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ThreadLoad_HPP
+#define RAJA_util_ThreadLoad_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace util
+{
+
+/*!
+ * The share of one thread in a parallel loop: the time it spent executing
+ * iterates, the time it waited for the other threads to finish, and the
+ * number of iterates it executed.
+ */
+struct ThreadLoad {
+  double busy_time = 0.0;
+  double wait_time = 0.0;
+  std::size_t iterations = 0;
+};
+
+/*!
+ * Number of plugins that use the thread loads; the OpenMP and TBB forall
+ * record them only while this is nonzero, see thread_loads_enabled().
+ */
+extern std::atomic<int> thread_load_requests;
+
+RAJA_INLINE
+bool thread_loads_enabled()
+{
+#if defined(RAJA_ENABLE_PLUGINS)
+  return thread_load_requests.load(std::memory_order_relaxed) != 0;
+#else
+  return false;
+#endif
+}
+
+/*!
+ * The thread loads of the instrumented loops launched by the calling thread,
+ * summed per thread of the team since they were last cleared.  Plugins
+ * set them aside and clear them in preLaunch, read them in postLaunch, and
+ * then add them to the loads they set aside, which belong to the enclosing
+ * launch of a nested one.
+ */
+std::vector<ThreadLoad>& last_thread_loads();
+
+}  // namespace util
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Trace_Plugin_HPP
+#define RAJA_Trace_Plugin_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginReport.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * Plugin that records a timeline of the kernel launches in the Chrome
+   * trace event format, which can be opened in chrome://tracing or
+   * Perfetto.
+   *
+   * The plugin is only active when the environment variable RAJA_TRACE
+   * names a trace file, which finalize_plugins() writes.  Each thread
+   * records its launches without locking in its own ring buffer of
+   * RAJA_TRACE_EVENTS events (65536 by default); when a ring is full its
+   * oldest events are overwritten.  Kernel names are copied when they are
+   * recorded, since RAJA::Name strings only have to outlive their kernel.
+   *
+   * Launches are timed on the host, so asynchronous device kernels only
+   * show their launch times.
+   */
+  class TracePlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    using ClockType = std::chrono::steady_clock;
+
+    struct Event {
+      const char* kernel_name;
+      const char* policy_name;
+      std::size_t iterations;
+      Platform platform;
+      ClockType::time_point begin;
+      ClockType::time_point end;
+    };
+
+    TracePlugin();
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! Writes the recorded events as a trace event JSON object
+    void writeTrace(std::ostream& os) const;
+
+    //! Number of events recorded so far, excluding overwritten events
+    std::size_t numEvents() const;
+
+  private:
+    //! Ring of the events of one thread, written only by that thread
+    struct ThreadBuffer {
+      ThreadBuffer(std::size_t capacity, int tid)
+        : events(capacity), recorded(0), thread_id(tid) {}
+
+      std::vector<Event> events;
+      std::atomic<std::size_t> recorded;
+      int thread_id;
+
+      //! Begin times of the launches in progress on this thread
+      std::vector<ClockType::time_point> begins;
+
+      //! Copies of the kernel names of the events
+      detail::NameTable names;
+    };
+
+    ThreadBuffer& getThreadBuffer();
+
+    std::string m_path;
+    std::size_t m_capacity;
+    ClockType::time_point m_start;
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+
+  };  // end TracePlugin class
+
+  void linkTracePlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -19,13 +19,16 @@
 #define RAJA_VIEW_HPP
 
 #include <type_traits>
+#include <utility>
 
 #include "RAJA/config.hpp"
 
 #include "RAJA/pattern/atomic.hpp"
+#include "RAJA/pattern/vector/VectorIndex.hpp"
 
 #include "RAJA/util/Layout.hpp"
 #include "RAJA/util/OffsetLayout.hpp"
+#include "RAJA/util/ReducedPrecision.hpp"
 
 namespace RAJA
 {
@@ -60,6 +63,10 @@ struct View {
       >
     >;
   using NonConstView = View<nc_value_type, layout_type, nc_pointer_type>;
+  // value_type & for raw pointers, or the proxy returned by pointer types
+  // such as ConvertingPtr
+  using reference_type =
+      decltype(std::declval<pointer_type const &>()[Index_type(0)]);
 
   layout_type const layout;
   pointer_type data;
@@ -108,11 +115,26 @@ struct View {
   // making this specifically typed would require unpacking the layout,
   // this is easier to maintain
   template <typename... Args>
-  RAJA_HOST_DEVICE RAJA_INLINE value_type &operator()(Args... args) const
+  RAJA_HOST_DEVICE RAJA_INLINE
+      typename std::enable_if<!detail::any_vector_index<Args...>::value,
+                              reference_type>::type
+      operator()(Args... args) const
   {
     auto idx = stripIndexType(layout(args...));
     return data[idx];
   }
+
+  // indexing with a VectorIndex references size() elements at once
+  template <typename... Args>
+  RAJA_INLINE typename std::enable_if<
+      detail::any_vector_index<Args...>::value,
+      typename detail::vector_ref<layout_type, value_type, Args...>::type>::type
+  operator()(Args... args) const
+  {
+    static_assert(std::is_pointer<pointer_type>::value,
+                  "Vector indexing requires a View of a raw pointer");
+    return make_vector_ref(layout, data, args...);
+  }
 };
 
 
@@ -311,7 +333,8 @@ struct TypedViewBase {
     return RAJA::TypedViewBase<ValueType, ValueType *, typename add_offset<LayoutType>::type, IndexTypes...>(base_.data, shift_layout);
   }
 
-  RAJA_HOST_DEVICE RAJA_INLINE ValueType &operator()(IndexTypes... args) const
+  RAJA_HOST_DEVICE RAJA_INLINE typename Base::reference_type operator()(
+      IndexTypes... args) const
   {
     return base_.operator()(stripIndexType(args)...);
   }
@@ -321,6 +344,23 @@ template <typename ValueType, typename LayoutType, typename... IndexTypes>
 using TypedView =
     TypedViewBase<ValueType, ValueType *, LayoutType, IndexTypes...>;
 
+/*!
+ * @brief A View of data stored as StorageType and accessed as ValueType.
+ *
+ * Loads convert to ValueType and stores convert back, so kernels compute in
+ * ValueType while moving only sizeof(StorageType) bytes per element:
+ *
+ *     std::vector<float> frac(N);
+ *     RAJA::ConvertingView<double, float, RAJA::Layout<1>> f(frac.data(), N);
+ *     f(i) = 0.5 * f(i);   // float storage, double arithmetic
+ *
+ * StorageType may be float, RAJA::bfloat16, RAJA::float16, or any type with
+ * conversions to and from ValueType.
+ */
+template <typename ValueType, typename StorageType, typename LayoutType>
+using ConvertingView =
+    View<ValueType, LayoutType, ConvertingPtr<ValueType, StorageType>>;
+
 template <typename ViewType, typename AtomicPolicy = RAJA::auto_atomic>
 struct AtomicViewWrapper {
   using base_type = ViewType;
@@ -8,6 +8,8 @@
 #ifndef RAJA_plugins_HPP
 #define RAJA_plugins_HPP
 
+#include "RAJA/config.hpp"
+
 #include "RAJA/util/PluginContext.hpp"
 #include "RAJA/util/PluginOptions.hpp"
 #include "RAJA/util/PluginStrategy.hpp"
@@ -28,48 +30,72 @@ RAJA_INLINE
 void
 callPreCapturePlugins(const PluginContext& p)
 {
+#if defined(RAJA_ENABLE_PLUGINS)
+  if (!plugins_active()) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->preCapture(p);
   }
+#else
+  RAJA_UNUSED_VAR(p);
+#endif
 }
 
 RAJA_INLINE
 void
 callPostCapturePlugins(const PluginContext& p)
 {
+#if defined(RAJA_ENABLE_PLUGINS)
+  if (!plugins_active()) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->postCapture(p);
   }
+#else
+  RAJA_UNUSED_VAR(p);
+#endif
 }
 
 RAJA_INLINE
 void
 callPreLaunchPlugins(const PluginContext& p)
 {
+#if defined(RAJA_ENABLE_PLUGINS)
+  if (!plugins_active()) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->preLaunch(p);
   }
+#else
+  RAJA_UNUSED_VAR(p);
+#endif
 }
 
 RAJA_INLINE
 void
 callPostLaunchPlugins(const PluginContext& p)
 {
+#if defined(RAJA_ENABLE_PLUGINS)
+  if (!plugins_active()) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->postLaunch(p);
   }
+#else
+  RAJA_UNUSED_VAR(p);
+#endif
 }
 
 RAJA_INLINE
@@ -0,0 +1,77 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file with software prefetch hints.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_prefetch_HPP
+#define RAJA_util_prefetch_HPP
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace util
+{
+
+/*!
+ * Hints that the cache line holding addr will be read soon.  This is a
+ * no-op on compilers without __builtin_prefetch.
+ */
+RAJA_INLINE void prefetch(const void *addr)
+{
+#if defined(__GNUC__) || defined(__clang__) || defined(__INTEL_COMPILER)
+  __builtin_prefetch(addr, 0, 3);
+#else
+  RAJA_UNUSED_VAR(addr);
+#endif
+}
+
+//! Address of element i of a pointer
+template <typename T, typename IndexType>
+RAJA_INLINE T *prefetch_address(T *ptr, IndexType i)
+{
+  return ptr + stripIndexType(i);
+}
+
+//! Address of element i of a one-dimensional View
+template <typename ViewType, typename IndexType>
+RAJA_INLINE auto prefetch_address(ViewType const &view, IndexType i)
+    -> decltype(&view(i))
+{
+  return &view(i);
+}
+
+/*!
+ * Prefetches the index at it[n]; indices are only prefetched from
+ * segments that store them, such as ListSegments.
+ */
+template <typename T, typename DiffType>
+RAJA_INLINE void prefetch_index(T *it, DiffType n)
+{
+  prefetch(it + n);
+}
+
+template <typename Iterator, typename DiffType>
+RAJA_INLINE void prefetch_index(Iterator const &, DiffType)
+{
+}
+
+}  // namespace util
+}  // namespace RAJA
+
+#endif
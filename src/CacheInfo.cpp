@@ -0,0 +1,183 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/CacheInfo.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#define RAJA_CACHEINFO_HAVE_CPUID
+#endif
+
+namespace
+{
+
+const char* const level_env[RAJA::util::CacheInfo::num_levels] = {
+    "RAJA_CACHE_L1", "RAJA_CACHE_L2", "RAJA_CACHE_L3"};
+
+bool readFile(const std::string& path, std::string& value)
+{
+  std::ifstream file(path);
+  return static_cast<bool>(file >> value);
+}
+
+// parses sysfs sizes, such as "48K" or "32M"
+size_t parseSize(const std::string& value)
+{
+  char* end = nullptr;
+  size_t size = std::strtoull(value.c_str(), &end, 10);
+  if (*end == 'K') {
+    size *= 1024;
+  } else if (*end == 'M') {
+    size *= 1024 * 1024;
+  }
+  return size;
+}
+
+void detectSysfs(RAJA::util::CacheInfo& info)
+{
+  for (int index = 0;; ++index) {
+    std::string const dir = "/sys/devices/system/cpu/cpu0/cache/index" +
+                            std::to_string(index) + "/";
+    std::string level, type, size, line;
+    if (!readFile(dir + "level", level) || !readFile(dir + "type", type) ||
+        !readFile(dir + "size", size)) {
+      return;
+    }
+
+    int const l = std::atoi(level.c_str());
+    if (type == "Instruction" || l < 1 ||
+        l > RAJA::util::CacheInfo::num_levels) {
+      continue;
+    }
+
+    info.level_bytes[l - 1] = parseSize(size);
+    if (l == 1 && readFile(dir + "coherency_line_size", line)) {
+      info.line_bytes = parseSize(line);
+    }
+  }
+}
+
+#if defined(RAJA_CACHEINFO_HAVE_CPUID)
+// Intel's leaf 4 and AMD's leaf 0x8000001D describe one cache per subleaf
+void detectCpuidLeaf(unsigned leaf, RAJA::util::CacheInfo& info)
+{
+  unsigned eax, ebx, ecx, edx;
+  if (__get_cpuid_max(leaf & 0x80000000u, nullptr) < leaf) {
+    return;
+  }
+
+  for (unsigned sub = 0;; ++sub) {
+    __cpuid_count(leaf, sub, eax, ebx, ecx, edx);
+
+    unsigned const type = eax & 0x1f;
+    if (type == 0) {
+      return;
+    }
+
+    int const l = (eax >> 5) & 0x7;
+    if (type == 2 || l < 1 || l > RAJA::util::CacheInfo::num_levels) {
+      continue;
+    }
+
+    size_t const line = (ebx & 0xfff) + 1;
+    size_t const partitions = ((ebx >> 12) & 0x3ff) + 1;
+    size_t const ways = ((ebx >> 22) & 0x3ff) + 1;
+    size_t const sets = size_t(ecx) + 1;
+
+    info.level_bytes[l - 1] = ways * partitions * line * sets;
+    if (l == 1) {
+      info.line_bytes = line;
+    }
+  }
+}
+#endif
+
+RAJA::util::CacheInfo detect()
+{
+  RAJA::util::CacheInfo info{64, {0, 0, 0}};
+
+  detectSysfs(info);
+
+#if defined(RAJA_CACHEINFO_HAVE_CPUID)
+  if (info.level_bytes[0] == 0) {
+    detectCpuidLeaf(4, info);
+  }
+  if (info.level_bytes[0] == 0) {
+    detectCpuidLeaf(0x8000001Du, info);
+  }
+#endif
+
+  size_t const defaults[RAJA::util::CacheInfo::num_levels] = {
+      32 * 1024, 1024 * 1024, 32 * 1024 * 1024};
+
+  for (int l = 0; l < RAJA::util::CacheInfo::num_levels; ++l) {
+    if (char const* env = std::getenv(level_env[l])) {
+      info.level_bytes[l] = std::strtoull(env, nullptr, 10);
+    }
+    if (info.level_bytes[l] == 0) {
+      // a missing level (e.g. no L3) acts like the level before it
+      info.level_bytes[l] =
+          l > 0 ? info.level_bytes[l - 1] : defaults[l];
+    }
+  }
+
+  return info;
+}
+
+}  // namespace
+
+namespace RAJA
+{
+namespace util
+{
+
+constexpr int CacheInfo::num_levels;
+
+const CacheInfo& cache_info()
+{
+  static const CacheInfo info = detect();
+  return info;
+}
+
+size_t cache_size(int level)
+{
+  if (level < 1) {
+    level = 1;
+  } else if (level > CacheInfo::num_levels) {
+    level = CacheInfo::num_levels;
+  }
+  return cache_info().level_bytes[level - 1];
+}
+
+size_t cache_tile_extent(int level, int num_dims, size_t bytes_per_point)
+{
+  if (num_dims < 1) {
+    num_dims = 1;
+  }
+  if (bytes_per_point < 1) {
+    bytes_per_point = 1;
+  }
+
+  double const points = double(cache_size(level) / 2) / bytes_per_point;
+
+  // nudge up so that exact powers are not truncated
+  size_t extent = static_cast<size_t>(std::pow(points, 1.0 / num_dims) + 1e-6);
+
+  if (extent >= 16) {
+    extent -= extent % 8;
+  }
+  return extent > 0 ? extent : 1;
+}
+
+}  // namespace util
+}  // namespace RAJA
@@ -44,6 +44,8 @@ namespace util {
 
 KokkosPluginLoader::KokkosPluginLoader()
 {
+  setActive(false);
+
   char *env = getenv("KOKKOS_PLUGINS");
   if (env == nullptr)
   {
@@ -55,13 +57,15 @@ KokkosPluginLoader::KokkosPluginLoader()
   {
     func(0, kokkos_interface_version, 0, nullptr);
   }
+
+  setActive(!pre_functions.empty() || !post_functions.empty());
 }
 
 void KokkosPluginLoader::preLaunch(const RAJA::util::PluginContext& p)
 {
   for (auto &func : pre_functions)
   {
-    func("", 0, &(p.kID));
+    func(p.kernel_name ? p.kernel_name : "", 0, &(p.kID));
   }
 }
 
@@ -83,6 +87,8 @@ void KokkosPluginLoader::finalize()
   pre_functions.clear();
   post_functions.clear();
   finalize_functions.clear();
+
+  setActive(false);
 }
 
 // Initialize plugin from a shared object file specified by 'path'.
@@ -0,0 +1,173 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/LoadBalancePlugin.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+
+// Thread loads of the launches in progress on this thread that enclose the
+// current launch, outermost first
+thread_local std::vector<std::vector<RAJA::util::ThreadLoad>> enclosing_loads;
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+LoadBalancePlugin::LoadBalancePlugin()
+{
+  char *env = ::getenv("RAJA_LOAD_BALANCE");
+  if (nullptr == env)
+  {
+    setActive(false);
+    return;
+  }
+  m_path = env;
+  ++thread_load_requests;
+}
+
+LoadBalancePlugin::~LoadBalancePlugin()
+{
+  if (!m_path.empty()) {
+    --thread_load_requests;
+  }
+}
+
+void LoadBalancePlugin::preLaunch(const RAJA::util::PluginContext&)
+{
+  // set aside the loads of the enclosing launch, if this one is nested
+  std::vector<ThreadLoad>& loads = last_thread_loads();
+  enclosing_loads.emplace_back();
+  enclosing_loads.back().swap(loads);
+  loads.clear();
+}
+
+void LoadBalancePlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  std::vector<ThreadLoad>& loads = last_thread_loads();
+
+  // launches that did not run an OpenMP or TBB loop have no thread loads
+  if (!loads.empty()) {
+    record(p, loads);
+  }
+  if (enclosing_loads.empty()) {
+    loads.clear();
+    return;
+  }
+
+  // the loads of a nested launch are part of the enclosing launch
+  std::vector<ThreadLoad>& enclosing = enclosing_loads.back();
+  if (enclosing.size() < loads.size()) {
+    enclosing.resize(loads.size());
+  }
+  for (std::size_t t = 0; t < loads.size(); ++t) {
+    enclosing[t].busy_time += loads[t].busy_time;
+    enclosing[t].wait_time += loads[t].wait_time;
+    enclosing[t].iterations += loads[t].iterations;
+  }
+  loads.swap(enclosing);
+  enclosing_loads.pop_back();
+}
+
+void LoadBalancePlugin::record(const PluginContext& p,
+                               std::vector<ThreadLoad> const& loads)
+{
+  double max_busy = 0.0;
+  double sum_busy = 0.0;
+  double wait = 0.0;
+  std::size_t max_iterations = 0;
+  std::size_t sum_iterations = 0;
+  for (ThreadLoad const& load : loads) {
+    max_busy = std::max(max_busy, load.busy_time);
+    sum_busy += load.busy_time;
+    wait += load.wait_time;
+    max_iterations = std::max(max_iterations, load.iterations);
+    sum_iterations += load.iterations;
+  }
+  double const num_threads = static_cast<double>(loads.size());
+  double const mean_busy = sum_busy / num_threads;
+
+  m_kernels.update(
+      p.kernel_name, p.policy_name, [&](KernelBalance& kernel) {
+        kernel.calls += 1;
+        kernel.threads = std::max(kernel.threads, loads.size());
+        kernel.max_busy_time += max_busy;
+        kernel.mean_busy_time += mean_busy;
+        if (mean_busy > 0.0) {
+          kernel.max_imbalance =
+              std::max(kernel.max_imbalance, max_busy / mean_busy);
+        }
+        kernel.wait_time += wait;
+        kernel.max_iterations += static_cast<double>(max_iterations);
+        kernel.mean_iterations += sum_iterations / num_threads;
+      });
+}
+
+std::vector<LoadBalancePlugin::KernelBalance> LoadBalancePlugin::getKernels() const
+{
+  return m_kernels.sorted([](KernelBalance const& a, KernelBalance const& b) {
+    return a.wait_time > b.wait_time;
+  });
+}
+
+void LoadBalancePlugin::writeCSV(std::ostream& os) const
+{
+  os << "kernel,policy,calls,threads,imbalance,max_imbalance,"
+        "iteration_imbalance,max_busy_s,mean_busy_s,wait_s\n";
+  for (auto const& kernel : getKernels()) {
+    os << detail::quoteCSV(kernel.kernel_name) << ','
+       << detail::quoteCSV(kernel.policy_name) << ','
+       << kernel.calls << ','
+       << kernel.threads << ','
+       << kernel.imbalance() << ','
+       << kernel.max_imbalance << ','
+       << kernel.iteration_imbalance() << ','
+       << kernel.max_busy_time << ','
+       << kernel.mean_busy_time << ','
+       << kernel.wait_time << '\n';
+  }
+}
+
+void LoadBalancePlugin::writeJSON(std::ostream& os) const
+{
+  os << "{\n  \"kernels\": [";
+  const char* sep = "\n";
+  for (auto const& kernel : getKernels()) {
+    os << sep
+       << "    {\"kernel\": " << detail::quoteJSON(kernel.kernel_name)
+       << ", \"policy\": " << detail::quoteJSON(kernel.policy_name)
+       << ", \"calls\": " << kernel.calls
+       << ", \"threads\": " << kernel.threads
+       << ", \"imbalance\": " << kernel.imbalance()
+       << ", \"max_imbalance\": " << kernel.max_imbalance
+       << ", \"iteration_imbalance\": " << kernel.iteration_imbalance()
+       << ", \"max_busy_s\": " << kernel.max_busy_time
+       << ", \"mean_busy_s\": " << kernel.mean_busy_time
+       << ", \"wait_s\": " << kernel.wait_time << "}";
+    sep = ",\n";
+  }
+  os << "\n  ]\n}\n";
+}
+
+void LoadBalancePlugin::finalize()
+{
+  if (m_path.empty()) return;
+
+  detail::writeReport(*this, "LoadBalancePlugin", m_path);
+
+  m_kernels.clear();
+}
+
+void linkLoadBalancePlugin() {}
+
+} // end namespace util
+} // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::LoadBalancePlugin> P("LoadBalancePlugin", "Measures the load imbalance of OpenMP and TBB loops.");
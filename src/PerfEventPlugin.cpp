@@ -0,0 +1,512 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/PerfEventPlugin.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+
+#include "RAJA/util/CacheInfo.hpp"
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const char* default_counters = "cycles,instructions,cache-references,cache-misses";
+
+std::atomic<bool> warned{false};
+
+void warnUnavailable(const char* why)
+{
+  if (!warned.exchange(true)) {
+    printf("[PerfEventPlugin]: perf events are unavailable (%s), only counting launches\n", why);
+  }
+}
+
+#if defined(__linux__)
+
+struct CounterSpec {
+  const char* name;
+  uint32_t type;
+  uint64_t config;
+};
+
+constexpr uint64_t llc(uint64_t op, uint64_t result)
+{
+  return PERF_COUNT_HW_CACHE_LL | (op << 8) | (result << 16);
+}
+
+const CounterSpec counter_specs[] = {
+  {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+  {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+  {"cache-references", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES},
+  {"cache-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+  {"branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+  {"LLC-loads", PERF_TYPE_HW_CACHE,
+   llc(PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_ACCESS)},
+  {"LLC-load-misses", PERF_TYPE_HW_CACHE,
+   llc(PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+  {"LLC-stores", PERF_TYPE_HW_CACHE,
+   llc(PERF_COUNT_HW_CACHE_OP_WRITE, PERF_COUNT_HW_CACHE_RESULT_ACCESS)},
+  {"LLC-store-misses", PERF_TYPE_HW_CACHE,
+   llc(PERF_COUNT_HW_CACHE_OP_WRITE, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+};
+
+int openCounter(uint32_t type, uint64_t config, pid_t tid, int group_fd)
+{
+  perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = (group_fd == -1) ? 1 : 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP;
+  return static_cast<int>(
+      syscall(__NR_perf_event_open, &attr, tid, -1, group_fd, 0));
+}
+
+using ThreadId = pid_t;
+
+ThreadId currentThread() { return static_cast<ThreadId>(syscall(SYS_gettid)); }
+
+#else
+
+using ThreadId = int;
+
+ThreadId currentThread() { return 0; }
+
+#endif
+
+using Counts = std::vector<uint64_t>;
+
+/*!
+ * The counter group of one thread.  It is opened with the thread's id, so
+ * any thread of the process can read it.
+ */
+struct CounterGroup {
+  std::vector<int> fds;
+  Counts values;
+
+  CounterGroup() = default;
+  CounterGroup(const CounterGroup&) = delete;
+  CounterGroup& operator=(const CounterGroup&) = delete;
+
+  ~CounterGroup() { close(); }
+
+  //! Opens the group, returning errno on failure
+  int open(const std::vector<std::pair<uint32_t, uint64_t>>& events,
+           ThreadId tid)
+  {
+#if defined(__linux__)
+    for (auto const& event : events) {
+      int fd = openCounter(event.first,
+                           event.second,
+                           tid,
+                           fds.empty() ? -1 : fds.front());
+      if (fd < 0) {
+        int error = errno;
+        close();
+        return error;
+      }
+      fds.push_back(fd);
+    }
+    values.resize(1 + fds.size());
+    ioctl(fds.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return 0;
+#else
+    (void)events;
+    (void)tid;
+    return ENOSYS;
+#endif
+  }
+
+  bool available() const { return !fds.empty(); }
+
+  //! Reads the group into counts, which is empty if it is unavailable
+  void read(Counts& counts)
+  {
+    counts.clear();
+#if defined(__linux__)
+    if (!available()) return;
+    ssize_t bytes = ::read(fds.front(),
+                           values.data(),
+                           values.size() * sizeof(uint64_t));
+    if (bytes != static_cast<ssize_t>(values.size() * sizeof(uint64_t))) {
+      return;
+    }
+    counts.assign(values.begin() + 1, values.end());
+#endif
+  }
+
+  void close()
+  {
+#if defined(__linux__)
+    for (int fd : fds) {
+      ::close(fd);
+    }
+#endif
+    fds.clear();
+  }
+};
+
+/*!
+ * The counter groups of all threads of the process, by thread id.  Groups
+ * of threads that have exited are closed when the threads are listed again.
+ */
+class ProcessCounters
+{
+public:
+  //! The group of the calling thread, or nullptr if it cannot be opened
+  CounterGroup* current(
+      const std::vector<std::pair<uint32_t, uint64_t>>& events)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return find_or_open(events, currentThread());
+  }
+
+  //! Opens groups for new threads and reads the groups of all threads
+  void readAll(const std::vector<std::pair<uint32_t, uint64_t>>& events,
+               std::map<ThreadId, Counts>& counts)
+  {
+    counts.clear();
+    std::lock_guard<std::mutex> lock(m_mutex);
+#if defined(__linux__)
+    std::set<ThreadId> live;
+    if (DIR* dir = opendir("/proc/self/task")) {
+      while (dirent* entry = readdir(dir)) {
+        ThreadId tid = static_cast<ThreadId>(atoi(entry->d_name));
+        if (tid > 0) live.insert(tid);
+      }
+      closedir(dir);
+    }
+    for (auto it = m_groups.begin(); it != m_groups.end();) {
+      it = live.count(it->first) ? std::next(it) : m_groups.erase(it);
+    }
+    for (ThreadId tid : live) {
+      if (CounterGroup* group = find_or_open(events, tid)) {
+        group->read(counts[tid]);
+      }
+    }
+#else
+    (void)events;
+#endif
+  }
+
+private:
+  CounterGroup* find_or_open(
+      const std::vector<std::pair<uint32_t, uint64_t>>& events,
+      ThreadId tid)
+  {
+    auto it = m_groups.find(tid);
+    if (it == m_groups.end()) {
+      std::unique_ptr<CounterGroup> group(new CounterGroup);
+      it = m_groups.emplace(tid, std::move(group)).first;
+      int error = it->second->open(events, tid);
+      if (error != 0 && tid == currentThread()) {
+        warnUnavailable(strerror(error));
+      }
+    }
+    return it->second->available() ? it->second.get() : nullptr;
+  }
+
+  std::mutex m_mutex;
+  std::map<ThreadId, std::unique_ptr<CounterGroup>> m_groups;
+};
+
+ProcessCounters process_counters;
+
+/*!
+ * The counter group of the calling thread, opened on its first launch.  It
+ * is only used by the calling thread, so reading it takes no lock.
+ */
+CounterGroup* threadCounters(
+    const std::vector<std::pair<uint32_t, uint64_t>>& events)
+{
+  thread_local CounterGroup group;
+  thread_local bool opened = false;
+  if (!opened) {
+    opened = true;
+    int error = group.open(events, currentThread());
+    if (error != 0) {
+      warnUnavailable(strerror(error));
+    }
+  }
+  return group.available() ? &group : nullptr;
+}
+
+/*!
+ * The counter group of the launching thread.  With all threads counted it
+ * is the group that the launches counting the whole process read.
+ */
+CounterGroup* launchingThreadCounters(
+    const std::vector<std::pair<uint32_t, uint64_t>>& events,
+    bool all_threads)
+{
+  return all_threads ? process_counters.current(events)
+                     : threadCounters(events);
+}
+
+//! Number of launches in progress on any thread, when counting all threads
+std::atomic<int> launches_in_progress{0};
+
+/*!
+ * The counts at the start of a launch in progress: of every thread of the
+ * process if all threads are counted and no other launch was in progress
+ * when it started, otherwise of the launching thread only.
+ */
+struct LaunchStart {
+  bool process = false;
+  std::map<ThreadId, Counts> threads;
+  Counts thread;
+};
+
+thread_local std::vector<LaunchStart> launch_starts;
+
+//! Sums over the threads of end - start, for the threads in both
+Counts difference(const std::map<ThreadId, Counts>& start,
+                  const std::map<ThreadId, Counts>& end)
+{
+  Counts total;
+  for (auto const& entry : end) {
+    auto it = start.find(entry.first);
+    if (it == start.end() || it->second.size() != entry.second.size()) {
+      continue;
+    }
+    total.resize(entry.second.size(), 0);
+    for (std::size_t i = 0; i < total.size(); ++i) {
+      total[i] += entry.second[i] - it->second[i];
+    }
+  }
+  return total;
+}
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+PerfEventPlugin::PerfEventPlugin()
+{
+  char *env = ::getenv("RAJA_PERF_EVENTS");
+  if (nullptr == env)
+  {
+    setActive(false);
+    return;
+  }
+  m_path = env;
+  m_all_threads = (nullptr != ::getenv("RAJA_PERF_ALL_THREADS"));
+
+  char *counters = ::getenv("RAJA_PERF_COUNTERS");
+  std::string list(counters ? counters : default_counters);
+
+  std::string::size_type begin = 0;
+  while (begin <= list.size()) {
+    std::string::size_type end = list.find(',', begin);
+    if (end == std::string::npos) end = list.size();
+    std::string name = list.substr(begin, end - begin);
+    begin = end + 1;
+    if (name.empty()) continue;
+
+    bool found = false;
+#if defined(__linux__)
+    for (auto const& spec : counter_specs) {
+      if (name == spec.name) {
+        m_names.push_back(name);
+        m_events.emplace_back(spec.type, spec.config);
+        found = true;
+      }
+    }
+#endif
+    if (!found) {
+      printf("[PerfEventPlugin]: Unknown counter %s\n", name.c_str());
+    }
+  }
+}
+
+void PerfEventPlugin::preLaunch(const RAJA::util::PluginContext&)
+{
+  launch_starts.emplace_back();
+  LaunchStart& start = launch_starts.back();
+
+  // count all threads unless another launch may be adding to their counts
+  start.process =
+      m_all_threads && (launches_in_progress.fetch_add(1) == 0);
+  if (start.process) {
+    process_counters.readAll(m_events, start.threads);
+  } else if (CounterGroup* group = launchingThreadCounters(m_events, m_all_threads)) {
+    group->read(start.thread);
+  }
+}
+
+void PerfEventPlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  if (launch_starts.empty()) return;
+
+  LaunchStart& start = launch_starts.back();
+  Counts counts;
+  if (start.process) {
+    std::map<ThreadId, Counts> threads;
+    process_counters.readAll(m_events, threads);
+    counts = difference(start.threads, threads);
+  } else if (CounterGroup* group = launchingThreadCounters(m_events, m_all_threads)) {
+    group->read(counts);
+    if (counts.size() == start.thread.size()) {
+      for (std::size_t i = 0; i < counts.size(); ++i) {
+        counts[i] -= start.thread[i];
+      }
+    } else {
+      counts.clear();
+    }
+  }
+  bool thread_only = !start.process;
+  launch_starts.pop_back();
+  if (m_all_threads) {
+    --launches_in_progress;
+  }
+
+  record(p, counts, thread_only);
+}
+
+void PerfEventPlugin::record(const PluginContext& p,
+                             const std::vector<uint64_t>& counts,
+                             bool thread_only)
+{
+  m_counters.update(
+      p.kernel_name, p.policy_name, [&](KernelCounters& kernel) {
+        if (kernel.calls == 0) {
+          kernel.counts.assign(m_names.size(), 0);
+        }
+        kernel.calls += 1;
+        if (!counts.empty() && counts.size() == kernel.counts.size()) {
+          kernel.measured += 1;
+          if (thread_only) kernel.thread_only += 1;
+          for (std::size_t i = 0; i < counts.size(); ++i) {
+            kernel.counts[i] += counts[i];
+          }
+        }
+      });
+}
+
+std::vector<PerfEventPlugin::KernelCounters>
+PerfEventPlugin::getCounters() const
+{
+  auto index = [&](const char* name) -> int {
+    auto it = std::find(m_names.begin(), m_names.end(), name);
+    return it == m_names.end() ? -1 : static_cast<int>(it - m_names.begin());
+  };
+  int cycles = index("cycles");
+  int instructions = index("instructions");
+  int references = index("cache-references");
+  int misses = index("cache-misses");
+  int load_misses = index("LLC-load-misses");
+  int store_misses = index("LLC-store-misses");
+
+  double line_bytes = static_cast<double>(cache_info().line_bytes);
+
+  // the derived metrics do not change the order
+  std::vector<KernelCounters> sorted = m_counters.sorted(
+      [](KernelCounters const& a, KernelCounters const& b) {
+        if (a.counts.empty()) return a.calls > b.calls;
+        return a.counts.front() > b.counts.front();
+      });
+
+  for (auto& kernel : sorted) {
+    if (kernel.measured == 0) continue;
+    auto count = [&](int i) { return static_cast<double>(kernel.counts[i]); };
+    if (cycles >= 0 && instructions >= 0 && count(cycles) > 0) {
+      kernel.ipc = count(instructions) / count(cycles);
+    }
+    if (references >= 0 && misses >= 0 && count(references) > 0) {
+      kernel.cache_miss_rate = count(misses) / count(references);
+    }
+    if (load_misses >= 0 || store_misses >= 0) {
+      kernel.dram_bytes = line_bytes * ((load_misses >= 0 ? count(load_misses) : 0) +
+                                        (store_misses >= 0 ? count(store_misses) : 0));
+    } else if (misses >= 0) {
+      kernel.dram_bytes = line_bytes * count(misses);
+    }
+  }
+  return sorted;
+}
+
+void PerfEventPlugin::writeCSV(std::ostream& os) const
+{
+  os << "kernel,policy,calls,measured,thread_only";
+  for (auto const& name : m_names) {
+    os << ',' << name;
+  }
+  os << ",ipc,cache_miss_rate,dram_bytes\n";
+
+  for (auto const& kernel : getCounters()) {
+    os << detail::quoteCSV(kernel.kernel_name) << ','
+       << detail::quoteCSV(kernel.policy_name) << ','
+       << kernel.calls << ','
+       << kernel.measured << ','
+       << kernel.thread_only;
+    for (auto count : kernel.counts) {
+      os << ',' << count;
+    }
+    os << ',' << kernel.ipc
+       << ',' << kernel.cache_miss_rate
+       << ',' << kernel.dram_bytes << '\n';
+  }
+}
+
+void PerfEventPlugin::writeJSON(std::ostream& os) const
+{
+  os << "{\n  \"kernels\": [";
+  const char* sep = "\n";
+  for (auto const& kernel : getCounters()) {
+    os << sep
+       << "    {\"kernel\": " << detail::quoteJSON(kernel.kernel_name)
+       << ", \"policy\": " << detail::quoteJSON(kernel.policy_name)
+       << ", \"calls\": " << kernel.calls
+       << ", \"measured\": " << kernel.measured
+       << ", \"thread_only\": " << kernel.thread_only;
+    for (std::size_t i = 0; i < kernel.counts.size(); ++i) {
+      os << ", " << detail::quoteJSON(m_names[i]) << ": " << kernel.counts[i];
+    }
+    os << ", \"ipc\": " << kernel.ipc
+       << ", \"cache_miss_rate\": " << kernel.cache_miss_rate
+       << ", \"dram_bytes\": " << kernel.dram_bytes << "}";
+    sep = ",\n";
+  }
+  os << "\n  ]\n}\n";
+}
+
+void PerfEventPlugin::finalize()
+{
+  if (m_path.empty()) return;
+
+  detail::writeReport(*this, "PerfEventPlugin", m_path);
+
+  m_counters.clear();
+}
+
+void linkPerfEventPlugin() {}
+
+} // end namespace util
+} // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::PerfEventPlugin> P("PerfEventPlugin", "Reads hardware counters around kernel launches.");
@@ -12,7 +12,25 @@ RAJA_INSTANTIATE_REGISTRY(PluginRegistry);
 namespace RAJA {
 namespace util {
 
-PluginStrategy::PluginStrategy() = default;
+std::atomic<int> active_plugin_count{0};
+
+PluginStrategy::PluginStrategy() : m_active(true)
+{
+  ++active_plugin_count;
+}
+
+PluginStrategy::~PluginStrategy()
+{
+  setActive(false);
+}
+
+void PluginStrategy::setActive(bool active)
+{
+  if (active != m_active) {
+    m_active = active;
+    active_plugin_count += active ? 1 : -1;
+  }
+}
 
 void PluginStrategy::init(const PluginOptions&) { }
 
@@ -0,0 +1,191 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/RooflinePlugin.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+
+#include "RAJA/util/CacheInfo.hpp"
+#include "RAJA/util/Timer.hpp"
+
+namespace {
+
+// Timers of the launches in progress on this thread
+thread_local std::vector<RAJA::Timer> launch_timers;
+
+bool hasRoofline(const RAJA::util::PluginContext& p)
+{
+  return p.roofline.bytes_read > 0.0 || p.roofline.bytes_written > 0.0 ||
+         p.roofline.flops > 0.0;
+}
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+double measure_stream_triad(std::size_t num_elements, int repeats)
+{
+  std::unique_ptr<double[]> a(new double[num_elements]);
+  std::unique_ptr<double[]> b(new double[num_elements]);
+  std::unique_ptr<double[]> c(new double[num_elements]);
+  double* pa = a.get();
+  double* pb = b.get();
+  double* pc = c.get();
+  const long n = static_cast<long>(num_elements);
+
+  // first touch with the threads of the triad
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+  for (long i = 0; i < n; ++i) {
+    pa[i] = 0.0;
+    pb[i] = 1.0;
+    pc[i] = 2.0;
+  }
+
+  double best = 0.0;
+  for (int r = 0; r < repeats; ++r) {
+    RAJA::Timer timer;
+    timer.start();
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for
+#endif
+    for (long i = 0; i < n; ++i) {
+      pa[i] = pb[i] + 3.0 * pc[i];
+    }
+    timer.stop();
+    if (timer.elapsed() > 0.0) {
+      best = std::max(best, 3.0 * sizeof(double) * n / timer.elapsed());
+    }
+  }
+  return best;
+}
+
+RooflinePlugin::RooflinePlugin() : m_peak_bandwidth(0.0)
+{
+  char *env = ::getenv("RAJA_ROOFLINE");
+  if (nullptr == env)
+  {
+    setActive(false);
+    return;
+  }
+  m_path = env;
+
+  char *peak = ::getenv("RAJA_ROOFLINE_PEAK");
+  if (nullptr != peak)
+  {
+    m_peak_bandwidth = atof(peak) * 1.0e9;
+  }
+}
+
+void RooflinePlugin::preLaunch(const RAJA::util::PluginContext& p)
+{
+  if (!hasRoofline(p)) return;
+
+  launch_timers.emplace_back();
+  launch_timers.back().start();
+}
+
+void RooflinePlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  if (!hasRoofline(p) || launch_timers.empty()) return;
+
+  launch_timers.back().stop();
+  double time = launch_timers.back().elapsed();
+  launch_timers.pop_back();
+
+  double iterations = static_cast<double>(p.num_iterations);
+
+  m_kernels.update(
+      p.kernel_name, p.policy_name, [&](KernelRoofline& kernel) {
+        kernel.calls += 1;
+        kernel.time += time;
+        kernel.bytes +=
+            iterations * (p.roofline.bytes_read + p.roofline.bytes_written);
+        kernel.flops += iterations * p.roofline.flops;
+      });
+}
+
+std::vector<RooflinePlugin::KernelRoofline> RooflinePlugin::getKernels() const
+{
+  return m_kernels.sorted([](KernelRoofline const& a, KernelRoofline const& b) {
+    return a.time > b.time;
+  });
+}
+
+double RooflinePlugin::getPeakBandwidth()
+{
+  if (m_peak_bandwidth <= 0.0) {
+    // arrays four times the size of the last level cache
+    std::size_t elements = 4 * cache_size(3) / sizeof(double);
+    m_peak_bandwidth = measure_stream_triad(elements, 5);
+  }
+  return m_peak_bandwidth;
+}
+
+void RooflinePlugin::writeCSV(std::ostream& os)
+{
+  double peak = getPeakBandwidth();
+
+  os << "kernel,policy,calls,time_s,bytes,flops,intensity,GB/s,GFLOP/s,"
+        "percent_of_stream\n";
+  for (auto const& kernel : getKernels()) {
+    os << detail::quoteCSV(kernel.kernel_name) << ','
+       << detail::quoteCSV(kernel.policy_name) << ','
+       << kernel.calls << ','
+       << kernel.time << ','
+       << kernel.bytes << ','
+       << kernel.flops << ','
+       << kernel.intensity() << ','
+       << kernel.bandwidth() * 1.0e-9 << ','
+       << kernel.flop_rate() * 1.0e-9 << ','
+       << (peak > 0.0 ? 100.0 * kernel.bandwidth() / peak : 0.0) << '\n';
+  }
+}
+
+void RooflinePlugin::writeJSON(std::ostream& os)
+{
+  double peak = getPeakBandwidth();
+
+  os << "{\n  \"stream_GB/s\": " << peak * 1.0e-9 << ",\n  \"kernels\": [";
+  const char* sep = "\n";
+  for (auto const& kernel : getKernels()) {
+    os << sep
+       << "    {\"kernel\": " << detail::quoteJSON(kernel.kernel_name)
+       << ", \"policy\": " << detail::quoteJSON(kernel.policy_name)
+       << ", \"calls\": " << kernel.calls
+       << ", \"time_s\": " << kernel.time
+       << ", \"bytes\": " << kernel.bytes
+       << ", \"flops\": " << kernel.flops
+       << ", \"intensity\": " << kernel.intensity()
+       << ", \"GB/s\": " << kernel.bandwidth() * 1.0e-9
+       << ", \"GFLOP/s\": " << kernel.flop_rate() * 1.0e-9
+       << ", \"percent_of_stream\": "
+       << (peak > 0.0 ? 100.0 * kernel.bandwidth() / peak : 0.0) << "}";
+    sep = ",\n";
+  }
+  os << "\n  ]\n}\n";
+}
+
+void RooflinePlugin::finalize()
+{
+  if (m_path.empty()) return;
+
+  detail::writeReport(*this, "RooflinePlugin", m_path);
+
+  m_kernels.clear();
+}
+
+void linkRooflinePlugin() {}
+
+} // end namespace util
+} // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::RooflinePlugin> P("RooflinePlugin", "Reports the achieved bandwidth and flop rate of annotated kernels.");
@@ -24,6 +24,9 @@ namespace util {
   
 RuntimePluginLoader::RuntimePluginLoader()
 {
+  // the loaded plugins are active themselves
+  setActive(false);
+
   char *env = ::getenv("RAJA_PLUGINS");
   if (nullptr == env)
   {
@@ -0,0 +1,173 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/StatsPlugin.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "RAJA/util/Timer.hpp"
+
+namespace {
+
+// Timers of the launches in progress on this thread; launches nest when a
+// kernel is launched from inside another one.
+thread_local std::vector<RAJA::Timer> launch_timers;
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+StatsPlugin::StatsPlugin()
+{
+  char *env = ::getenv("RAJA_STATS");
+  if (nullptr == env)
+  {
+    setActive(false);
+    return;
+  }
+  m_path = env;
+}
+
+void StatsPlugin::preLaunch(const RAJA::util::PluginContext&)
+{
+  launch_timers.emplace_back();
+  launch_timers.back().start();
+}
+
+void StatsPlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  if (launch_timers.empty()) return;
+
+  launch_timers.back().stop();
+  double time = launch_timers.back().elapsed();
+  launch_timers.pop_back();
+
+  record(p, time);
+}
+
+StatsPlugin::ThreadStats& StatsPlugin::getThreadStats()
+{
+  thread_local ThreadStats* thread_stats = nullptr;
+  if (nullptr == thread_stats)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_threads.emplace_back(new ThreadStats);
+    thread_stats = m_threads.back().get();
+  }
+  return *thread_stats;
+}
+
+void StatsPlugin::record(const PluginContext& p, double time)
+{
+  ThreadStats& thread_stats = getThreadStats();
+
+  std::lock_guard<std::mutex> lock(thread_stats.mutex);
+
+  // policy names are static type names, so only kernel names are copied
+  KernelStats& stats = thread_stats.stats[std::make_pair(
+      thread_stats.names.intern(p.kernel_name), p.policy_name)];
+  if (stats.calls == 0) {
+    stats.min_time = time;
+    stats.max_time = time;
+  } else {
+    stats.min_time = std::min(stats.min_time, time);
+    stats.max_time = std::max(stats.max_time, time);
+  }
+  stats.calls += 1;
+  stats.total_time += time;
+  stats.iterations += p.num_iterations;
+}
+
+std::vector<StatsPlugin::KernelStats> StatsPlugin::getStats() const
+{
+  std::map<detail::KernelKey, KernelStats> merged;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto const& thread_stats : m_threads) {
+      std::lock_guard<std::mutex> thread_lock(thread_stats->mutex);
+      for (auto const& entry : thread_stats->stats) {
+        detail::KernelKey key =
+            detail::kernelKey(entry.first.first, entry.first.second);
+        KernelStats const& from = entry.second;
+        KernelStats& stats = merged[key];
+        if (stats.calls == 0) {
+          stats = from;
+          stats.kernel_name = key.first;
+          stats.policy_name = key.second;
+        } else {
+          stats.calls += from.calls;
+          stats.total_time += from.total_time;
+          stats.min_time = std::min(stats.min_time, from.min_time);
+          stats.max_time = std::max(stats.max_time, from.max_time);
+          stats.iterations += from.iterations;
+        }
+      }
+    }
+  }
+
+  return detail::sortedEntries(
+      merged,
+      [](KernelStats const& a, KernelStats const& b) {
+        return a.total_time > b.total_time;
+      });
+}
+
+void StatsPlugin::writeCSV(std::ostream& os) const
+{
+  os << "kernel,policy,calls,total_s,min_s,max_s,mean_s,iterations\n";
+  for (auto const& stats : getStats()) {
+    os << detail::quoteCSV(stats.kernel_name) << ','
+       << detail::quoteCSV(stats.policy_name) << ','
+       << stats.calls << ','
+       << stats.total_time << ','
+       << stats.min_time << ','
+       << stats.max_time << ','
+       << stats.mean_time() << ','
+       << stats.iterations << '\n';
+  }
+}
+
+void StatsPlugin::writeJSON(std::ostream& os) const
+{
+  os << "{\n  \"kernels\": [";
+  const char* sep = "\n";
+  for (auto const& stats : getStats()) {
+    os << sep
+       << "    {\"kernel\": " << detail::quoteJSON(stats.kernel_name)
+       << ", \"policy\": " << detail::quoteJSON(stats.policy_name)
+       << ", \"calls\": " << stats.calls
+       << ", \"total_s\": " << stats.total_time
+       << ", \"min_s\": " << stats.min_time
+       << ", \"max_s\": " << stats.max_time
+       << ", \"mean_s\": " << stats.mean_time()
+       << ", \"iterations\": " << stats.iterations << "}";
+    sep = ",\n";
+  }
+  os << "\n  ]\n}\n";
+}
+
+void StatsPlugin::finalize()
+{
+  if (m_path.empty()) return;
+
+  detail::writeReport(*this, "StatsPlugin", m_path);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (auto const& thread_stats : m_threads) {
+    std::lock_guard<std::mutex> thread_lock(thread_stats->mutex);
+    thread_stats->stats.clear();
+  }
+}
+
+void linkStatsPlugin() {}
+
+} // end namespace util
+} // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::StatsPlugin> P("StatsPlugin", "Collects per kernel timing statistics.");
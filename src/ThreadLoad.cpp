@@ -0,0 +1,22 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/ThreadLoad.hpp"
+
+namespace RAJA {
+namespace util {
+
+std::atomic<int> thread_load_requests{0};
+
+std::vector<ThreadLoad>& last_thread_loads()
+{
+  thread_local std::vector<ThreadLoad> loads;
+  return loads;
+}
+
+} // end namespace util
+} // end namespace RAJA
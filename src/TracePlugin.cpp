@@ -0,0 +1,163 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/TracePlugin.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+namespace {
+
+const std::size_t default_trace_events = 65536;
+
+const char* platformName(RAJA::Platform platform)
+{
+  switch (platform) {
+    case RAJA::Platform::host: return "host";
+    case RAJA::Platform::cuda: return "cuda";
+    case RAJA::Platform::hip: return "hip";
+    case RAJA::Platform::omp_target: return "omp_target";
+    default: return "undefined";
+  }
+}
+
+double microseconds(RAJA::util::TracePlugin::ClockType::duration d)
+{
+  return std::chrono::duration<double, std::micro>(d).count();
+}
+
+}  // namespace
+
+namespace RAJA {
+namespace util {
+
+TracePlugin::TracePlugin()
+  : m_capacity(default_trace_events), m_start(ClockType::now())
+{
+  char *env = ::getenv("RAJA_TRACE");
+  if (nullptr == env)
+  {
+    setActive(false);
+    return;
+  }
+  m_path = env;
+
+  char *events = ::getenv("RAJA_TRACE_EVENTS");
+  if (nullptr != events && atol(events) > 0)
+  {
+    m_capacity = static_cast<std::size_t>(atol(events));
+  }
+}
+
+TracePlugin::ThreadBuffer& TracePlugin::getThreadBuffer()
+{
+  thread_local ThreadBuffer* buffer = nullptr;
+  if (nullptr == buffer)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_buffers.emplace_back(
+        new ThreadBuffer(m_capacity, static_cast<int>(m_buffers.size())));
+    buffer = m_buffers.back().get();
+  }
+  return *buffer;
+}
+
+void TracePlugin::preLaunch(const RAJA::util::PluginContext&)
+{
+  getThreadBuffer().begins.push_back(ClockType::now());
+}
+
+void TracePlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  ClockType::time_point end = ClockType::now();
+
+  ThreadBuffer& buffer = getThreadBuffer();
+  if (buffer.begins.empty()) return;
+
+  std::size_t recorded = buffer.recorded.load(std::memory_order_relaxed);
+  Event& event = buffer.events[recorded % buffer.events.size()];
+  event.kernel_name = buffer.names.intern(p.kernel_name);
+  event.policy_name = p.policy_name;
+  event.iterations = p.num_iterations;
+  event.platform = p.platform;
+  event.begin = buffer.begins.back();
+  event.end = end;
+  buffer.begins.pop_back();
+
+  // publish the event to writeTrace
+  buffer.recorded.store(recorded + 1, std::memory_order_release);
+}
+
+std::size_t TracePlugin::numEvents() const
+{
+  std::size_t num = 0;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (auto const& buffer : m_buffers) {
+    std::size_t recorded = buffer->recorded.load(std::memory_order_acquire);
+    num += recorded < buffer->events.size() ? recorded : buffer->events.size();
+  }
+  return num;
+}
+
+void TracePlugin::writeTrace(std::ostream& os) const
+{
+  os << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+  const char* sep = "\n";
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (auto const& buffer : m_buffers) {
+    std::size_t capacity = buffer->events.size();
+    std::size_t recorded = buffer->recorded.load(std::memory_order_acquire);
+    std::size_t first = recorded > capacity ? recorded - capacity : 0;
+
+    for (std::size_t i = first; i < recorded; ++i) {
+      Event const& event = buffer->events[i % capacity];
+      os << sep << "{\"name\": "
+         << detail::quoteJSON(event.kernel_name ? event.kernel_name : "unnamed")
+         << ", \"cat\": \"RAJA\", \"ph\": \"X\""
+         << ", \"ts\": " << microseconds(event.begin - m_start)
+         << ", \"dur\": " << microseconds(event.end - event.begin)
+         << ", \"pid\": 0, \"tid\": " << buffer->thread_id
+         << ", \"args\": {\"policy\": "
+         << detail::quoteJSON(event.policy_name ? event.policy_name : "")
+         << ", \"iterations\": " << event.iterations
+         << ", \"platform\": \"" << platformName(event.platform) << "\"}}";
+      sep = ",\n";
+    }
+  }
+  os << "\n]}\n";
+}
+
+void TracePlugin::finalize()
+{
+  if (m_path.empty()) return;
+
+  std::ofstream trace(m_path);
+  if (!trace)
+  {
+    printf("[TracePlugin]: Could not open trace file %s\n", m_path.c_str());
+  }
+  else
+  {
+    trace.precision(15);
+    writeTrace(trace);
+  }
+
+  // the buffers stay registered with their threads
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (auto& buffer : m_buffers) {
+    buffer->recorded.store(0, std::memory_order_relaxed);
+  }
+}
+
+void linkTracePlugin() {}
+
+} // end namespace util
+} // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::TracePlugin> P("TracePlugin", "Records a timeline of kernel launches in the Chrome trace event format.");
@@ -0,0 +1,146 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Tests for omp_team_launch_t with teams executed by all threads of the
+// region, work-shared thread loops, teamSync barriers and team-shared memory,
+// and for omp_launch_t running the launch body once.
+//
+
+#include "RAJA_test-base.hpp"
+
+#include <omp.h>
+
+#include <atomic>
+#include <vector>
+
+using launch_policy =
+    RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t>;
+using teams_x = RAJA::expt::LoopPolicy<RAJA::loop_exec>;
+
+template <typename THREAD_POLICY>
+void TeamsOmpLaunchSharedTestImpl()
+{
+  constexpr int N = 100;
+
+  std::vector<int> out(N * N, -1);
+  int *out_ptr = &out[0];
+
+  RAJA::expt::launch<launch_policy>(RAJA::expt::HOST,
+    RAJA::expt::Resources(RAJA::expt::Teams(N),
+                          RAJA::expt::Threads(N),
+                          N * sizeof(int)),
+        [=](RAJA::expt::LaunchContext ctx) {
+
+          // Array shared within threads of the same team
+          int *s_A = ctx.getSharedMemory<int>(N);
+
+          RAJA::expt::loop<teams_x>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int c) {
+                    s_A[c] = r * N + c;
+                });
+
+                ctx.teamSync();
+
+                // read values written by other threads
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int c) {
+                    out_ptr[c + N * r] = s_A[N - 1 - c];
+                });
+
+                ctx.teamSync();
+
+              });  // loop r
+        });  // outer lambda
+
+  for (int r = 0; r < N; ++r) {
+    for (int c = 0; c < N; c++) {
+      ASSERT_EQ(r * N + N - 1 - c, out[c + r * N]);
+    }
+  }
+}
+
+TEST(TeamsOmpLaunch, SharedMemoryFor)
+{
+  TeamsOmpLaunchSharedTestImpl<RAJA::expt::LoopPolicy<RAJA::omp_for_exec>>();
+}
+
+TEST(TeamsOmpLaunch, SharedMemoryForNowait)
+{
+  TeamsOmpLaunchSharedTestImpl<
+      RAJA::expt::LoopPolicy<RAJA::omp_for_nowait_exec>>();
+}
+
+TEST(TeamsOmpLaunch, SharedMemoryTooLarge)
+{
+  RAJA::expt::launch<launch_policy>(RAJA::expt::HOST,
+    RAJA::expt::Resources(RAJA::expt::Teams(1),
+                          RAJA::expt::Threads(1),
+                          16),
+        [=](RAJA::expt::LaunchContext ctx) {
+          ASSERT_NE(ctx.getSharedMemory<char>(16), nullptr);
+          ASSERT_EQ(ctx.getSharedMemory<char>(1), nullptr);
+        });
+}
+
+TEST(TeamsOmpLaunch, TeamsOnlyParallelFor)
+{
+  constexpr int N = 1000;
+
+  std::vector<int> out(N, 0);
+  int *out_ptr = &out[0];
+  std::atomic<int> max_threads(0);
+
+  // the usual host pattern: Teams only, with work-shared team loops
+  RAJA::expt::launch<launch_policy>(RAJA::expt::HOST,
+    RAJA::expt::Resources(RAJA::expt::Teams(N)),
+        [=, &max_threads](RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<RAJA::expt::LoopPolicy<RAJA::omp_parallel_for_exec>>(
+              ctx, RAJA::RangeSegment(0, N), [&](int t) {
+                int seen = max_threads.load();
+                while (seen < omp_get_num_threads() &&
+                       !max_threads.compare_exchange_weak(
+                           seen, omp_get_num_threads())) {
+                }
+                out_ptr[t] += 1;
+              });
+        });
+
+  for (int t = 0; t < N; ++t) {
+    ASSERT_EQ(1, out[t]);
+  }
+  if (omp_get_max_threads() > 1) {
+    ASSERT_GT(max_threads.load(), 1);
+  }
+}
+
+TEST(TeamsOmpLaunch, OmpLaunchRunsBodyOnce)
+{
+  constexpr int N = 1000;
+
+  std::vector<int> out(N, 0);
+  int *out_ptr = &out[0];
+  int calls = 0;
+  int *calls_ptr = &calls;
+
+  RAJA::expt::launch<RAJA::expt::LaunchPolicy<RAJA::expt::omp_launch_t>>(
+      RAJA::expt::HOST,
+      RAJA::expt::Resources(RAJA::expt::Teams(N), RAJA::expt::Threads(4)),
+      [=](RAJA::expt::LaunchContext ctx) {
+        // outside of the parallel team loop, the body runs on one thread
+        *calls_ptr += 1;
+
+        RAJA::expt::loop<RAJA::expt::LoopPolicy<RAJA::omp_parallel_for_exec>>(
+            ctx, RAJA::RangeSegment(0, N), [&](int t) { out_ptr[t] += 1; });
+      });
+
+  ASSERT_EQ(1, calls);
+  for (int t = 0; t < N; ++t) {
+    ASSERT_EQ(1, out[t]);
+  }
+}
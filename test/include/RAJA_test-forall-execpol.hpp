@@ -23,10 +23,11 @@ using SequentialForallExecPols = camp::list< RAJA::seq_exec,
 //
 // Sequential execution policy types for reduction and atomic tests.
 //
-// Note: RAJA::simd_exec does not work with these.
+// Note: RAJA::simd_exec does not work with atomics.
 //
 using SequentialForallReduceExecPols = camp::list< RAJA::seq_exec,
-                                                   RAJA::loop_exec >;
+                                                   RAJA::loop_exec,
+                                                   RAJA::simd_exec >;
 
 using SequentialForallAtomicExecPols = camp::list< RAJA::seq_exec, 
                                                    RAJA::loop_exec >;
@@ -35,7 +36,9 @@ using SequentialForallAtomicExecPols = camp::list< RAJA::seq_exec,
 using OpenMPForallExecPols = 
   camp::list< RAJA::omp_parallel_exec<RAJA::omp_for_nowait_exec>
               , RAJA::omp_parallel_exec<RAJA::omp_for_exec>
+              , RAJA::omp_taskloop_exec<>
 #if defined(RAJA_TEST_EXHAUSTIVE)
+              , RAJA::omp_taskloop_exec<16>
               , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Static<4>>>
               , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Static<8>>>
               , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Dynamic<2>>>
@@ -47,6 +50,7 @@ using OpenMPForallReduceExecPols = OpenMPForallExecPols;
 
 using OpenMPForallAtomicExecPols =
   camp::list< RAJA::omp_parallel_exec<RAJA::omp_for_exec>
+              , RAJA::omp_taskloop_exec<>
 #if defined(RAJA_TEST_EXHAUSTIVE)
               , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Static<4>>>
               , RAJA::omp_parallel_exec<RAJA::omp_for_schedule_exec<RAJA::policy::omp::Static<8>>>
@@ -0,0 +1,34 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Helpers for the tests of the plugins in the plugin registry.
+//
+
+#ifndef __RAJA_test_plugin_HPP__
+#define __RAJA_test_plugin_HPP__
+
+#include "RAJA/RAJA.hpp"
+
+//
+// Returns the plugin registered as name, or nullptr if there is none.
+//
+template <typename Plugin>
+Plugin* findPlugin(const char* name)
+{
+  for (auto plugin = RAJA::util::PluginRegistry::begin();
+      plugin != RAJA::util::PluginRegistry::end();
+      ++plugin)
+  {
+    if ((*plugin).getName() == name) {
+      return static_cast<Plugin*>((*plugin).get().get());
+    }
+  }
+  return nullptr;
+}
+
+#endif // __RAJA_test_plugin_HPP__
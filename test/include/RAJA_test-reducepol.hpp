@@ -16,7 +16,8 @@
 #include "camp/list.hpp"
 
 // Sequential reduction policy types
-using SequentialReducePols = camp::list< RAJA::seq_reduce >;
+using SequentialReducePols = camp::list< RAJA::seq_reduce,
+                                         RAJA::simd_reduce >;
 
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPReducePols = 
@@ -24,7 +25,8 @@ using OpenMPReducePols =
   camp::list< RAJA::omp_reduce,
               RAJA::omp_reduce_ordered >;
 #else
-  camp::list< RAJA::omp_reduce >;
+  camp::list< RAJA::omp_reduce,
+              RAJA::simd_reduce >;
 #endif
 #endif
 
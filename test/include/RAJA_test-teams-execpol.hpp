@@ -74,6 +74,10 @@ using OpenMP_launch_policies = camp::list<
         camp::list<
          RAJA::expt::LaunchPolicy<RAJA::expt::omp_launch_t>,
          RAJA::expt::LoopPolicy<RAJA::omp_parallel_for_exec>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>>,
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::omp_parallel_for_exec>,
          RAJA::expt::LoopPolicy<RAJA::loop_exec>>>;
 #endif
 
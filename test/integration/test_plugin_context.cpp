@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <string>
+
+struct ContextData
+{
+  std::string kernel_name;
+  std::size_t num_iterations = 0;
+  std::string policy_name;
+  int launches = 0;
+};
+
+static ContextData context_data;
+
+class ContextPlugin :
+  public RAJA::util::PluginStrategy
+{
+  public:
+  void preLaunch(const RAJA::util::PluginContext& p) override {
+    context_data.kernel_name = p.kernel_name ? p.kernel_name : "";
+    context_data.num_iterations = p.num_iterations;
+    context_data.policy_name = p.policy_name ? p.policy_name : "";
+    context_data.launches++;
+  }
+};
+
+static RAJA::util::PluginRegistry::add<ContextPlugin> P("context-plugin", "Context");
+
+TEST(PluginTestContext, Active)
+{
+  ASSERT_TRUE(RAJA::util::plugins_active());
+}
+
+TEST(PluginTestContext, ForallName)
+{
+  context_data = ContextData{};
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::Name("named-forall"),
+                               RAJA::RangeSegment(0, 10),
+                               [=](int) {});
+
+  ASSERT_EQ(context_data.launches, 1);
+  ASSERT_EQ(context_data.kernel_name, "named-forall");
+  ASSERT_EQ(context_data.num_iterations, 10u);
+  ASSERT_NE(context_data.policy_name.find("seq_exec"), std::string::npos);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 5), [=](int) {});
+
+  ASSERT_EQ(context_data.launches, 2);
+  ASSERT_EQ(context_data.kernel_name, "");
+  ASSERT_EQ(context_data.num_iterations, 5u);
+}
+
+TEST(PluginTestContext, ForallIndexSetName)
+{
+  context_data = ContextData{};
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  iset.push_back(RAJA::RangeSegment(0, 4));
+  iset.push_back(RAJA::RangeSegment(10, 16));
+
+  RAJA::forall<RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>>(
+      RAJA::Name("named-iset"), iset, [=](int) {});
+
+  ASSERT_EQ(context_data.launches, 1);
+  ASSERT_EQ(context_data.kernel_name, "named-iset");
+  ASSERT_EQ(context_data.num_iterations, 10u);
+}
+
+TEST(PluginTestContext, KernelName)
+{
+  context_data = ContextData{};
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::seq_exec,
+        RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+
+  RAJA::kernel<Pol>(RAJA::Name("named-kernel"),
+                    RAJA::make_tuple(RAJA::RangeSegment(0, 3),
+                                     RAJA::RangeSegment(0, 4)),
+                    [=](int, int) {});
+
+  ASSERT_EQ(context_data.launches, 1);
+  ASSERT_EQ(context_data.kernel_name, "named-kernel");
+  ASSERT_EQ(context_data.num_iterations, 12u);
+  ASSERT_NE(context_data.policy_name.find("For"), std::string::npos);
+}
@@ -0,0 +1,117 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "RAJA/RAJA.hpp"
+#include "RAJA_test-plugin.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+TEST(PluginTestLoadBalance, Report)
+{
+  const char* path = getenv("RAJA_LOAD_BALANCE");
+  ASSERT_NE(path, nullptr);
+  ASSERT_TRUE(RAJA::util::thread_loads_enabled());
+
+  auto* balance_plugin =
+      findPlugin<RAJA::util::LoadBalancePlugin>("LoadBalancePlugin");
+  ASSERT_NE(balance_plugin, nullptr);
+
+  const int N = 1000;
+  double* x = new double[N];
+
+  // sequential loops have no thread loads and are not reported
+  RAJA::forall<RAJA::seq_exec>(RAJA::Name("balance-seq"),
+                               RAJA::RangeSegment(0, N),
+                               [=](int i) { x[i] = 0.0; });
+
+#if defined(RAJA_ENABLE_OPENMP)
+  // the work per iterate grows with the iterate
+  for (int r = 0; r < 2; ++r) {
+    RAJA::forall<RAJA::omp_parallel_for_static<>>(
+        RAJA::Name("balance-triangle"),
+        RAJA::RangeSegment(0, N),
+        [=](int i) {
+          double sum = 0.0;
+          for (int j = 0; j < i; ++j) {
+            sum += 1.0 / (j + 1);
+          }
+          x[i] = sum;
+        });
+  }
+#endif
+
+  auto kernels = balance_plugin->getKernels();
+  for (auto const& kernel : kernels) {
+    ASSERT_NE(kernel.kernel_name, "balance-seq");
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  ASSERT_EQ(kernels.size(), 1u);
+  ASSERT_EQ(kernels[0].kernel_name, "balance-triangle");
+  ASSERT_EQ(kernels[0].calls, 2u);
+  ASSERT_EQ(kernels[0].threads, std::size_t(omp_get_max_threads()));
+  ASSERT_GE(kernels[0].imbalance(), 1.0);
+  ASSERT_GE(kernels[0].max_imbalance, 1.0);
+  ASSERT_GE(kernels[0].wait_time, 0.0);
+  // a static schedule splits the iterates evenly
+  ASSERT_DOUBLE_EQ(kernels[0].mean_iterations, 2.0 * N / kernels[0].threads);
+#endif
+
+  delete[] x;
+
+  RAJA::util::finalize_plugins();
+
+  std::ifstream report(path);
+  ASSERT_TRUE(report.good());
+  std::stringstream contents;
+  contents << report.rdbuf();
+  ASSERT_NE(contents.str().find("\"kernels\""), std::string::npos);
+  ASSERT_TRUE(balance_plugin->getKernels().empty());
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+// a nested launch reports its own loads and adds them to the enclosing one
+TEST(PluginTestLoadBalance, Nested)
+{
+  auto* balance_plugin =
+      findPlugin<RAJA::util::LoadBalancePlugin>("LoadBalancePlugin");
+  ASSERT_NE(balance_plugin, nullptr);
+
+  const int N = 1000;
+  double* x = new double[N];
+
+  RAJA::forall<RAJA::seq_exec>(
+      RAJA::Name("balance-outer"),
+      RAJA::RangeSegment(0, 2),
+      [=](int) {
+        RAJA::forall<RAJA::omp_parallel_for_static<>>(
+            RAJA::Name("balance-inner"),
+            RAJA::RangeSegment(0, N),
+            [=](int i) { x[i] = i; });
+      });
+
+  delete[] x;
+
+  auto kernels = balance_plugin->getKernels();
+  ASSERT_EQ(kernels.size(), 2u);
+  for (auto const& kernel : kernels) {
+    if (kernel.kernel_name == "balance-inner") {
+      ASSERT_EQ(kernel.calls, 2u);
+      ASSERT_DOUBLE_EQ(kernel.mean_iterations, 2.0 * N / kernel.threads);
+    } else {
+      ASSERT_EQ(kernel.kernel_name, "balance-outer");
+      ASSERT_EQ(kernel.calls, 1u);
+      ASSERT_DOUBLE_EQ(kernel.mean_iterations, 2.0 * N / kernel.threads);
+    }
+  }
+
+  RAJA::util::finalize_plugins();
+}
+#endif
@@ -0,0 +1,57 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "RAJA/RAJA.hpp"
+#include "RAJA_test-plugin.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <fstream>
+
+// perf events may be unavailable where the test runs, so the counters are
+// only checked when they were read
+TEST(PluginTestPerfEvent, Counters)
+{
+  const char* path = getenv("RAJA_PERF_EVENTS");
+  ASSERT_NE(path, nullptr);
+
+  auto* perf_plugin =
+      findPlugin<RAJA::util::PerfEventPlugin>("PerfEventPlugin");
+  ASSERT_NE(perf_plugin, nullptr);
+  ASSERT_EQ(perf_plugin->getCounterNames().size(), 2u);
+
+  double* a = new double[1000];
+  for (int i = 0; i < 4; ++i) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::Name("perf-fill"),
+                                 RAJA::RangeSegment(0, 1000),
+                                 [=](int j) { a[j] = j; });
+  }
+  delete[] a;
+
+  auto counters = perf_plugin->getCounters();
+  ASSERT_EQ(counters.size(), 1u);
+  ASSERT_EQ(counters[0].kernel_name, "perf-fill");
+  ASSERT_EQ(counters[0].calls, 4u);
+  ASSERT_LE(counters[0].measured, 4u);
+  // no launch overlapped another, so with RAJA_PERF_ALL_THREADS all threads
+  // were counted, and otherwise every launch counted its own thread
+  if (getenv("RAJA_PERF_ALL_THREADS")) {
+    ASSERT_EQ(counters[0].thread_only, 0u);
+  } else {
+    ASSERT_EQ(counters[0].thread_only, counters[0].measured);
+  }
+  ASSERT_EQ(counters[0].counts.size(), 2u);
+  if (counters[0].measured > 0) {
+    ASSERT_GT(counters[0].counts[0], 0u);
+    ASSERT_GT(counters[0].ipc, 0.0);
+  }
+
+  RAJA::util::finalize_plugins();
+
+  std::ifstream report(path);
+  ASSERT_TRUE(report.good());
+  ASSERT_TRUE(perf_plugin->getCounters().empty());
+}
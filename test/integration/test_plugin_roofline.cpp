@@ -0,0 +1,69 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "RAJA/RAJA.hpp"
+#include "RAJA_test-plugin.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+TEST(PluginTestRoofline, Report)
+{
+  const char* path = getenv("RAJA_ROOFLINE");
+  ASSERT_NE(path, nullptr);
+
+  auto* roofline_plugin =
+      findPlugin<RAJA::util::RooflinePlugin>("RooflinePlugin");
+  ASSERT_NE(roofline_plugin, nullptr);
+
+  const int N = 1000;
+  double* x = new double[N];
+  double* y = new double[N];
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N), [=](int i) {
+    x[i] = 1.0;
+    y[i] = 2.0;
+  });
+
+  for (int r = 0; r < 2; ++r) {
+    RAJA::forall<RAJA::seq_exec>(
+        RAJA::Name("roofline-daxpy", RAJA::Roofline{16, 8, 2}),
+        RAJA::RangeSegment(0, N),
+        [=](int i) { y[i] += 3.0 * x[i]; });
+  }
+
+  delete[] x;
+  delete[] y;
+
+  // only the annotated kernel is reported
+  auto kernels = roofline_plugin->getKernels();
+  ASSERT_EQ(kernels.size(), 1u);
+  ASSERT_EQ(kernels[0].kernel_name, "roofline-daxpy");
+  ASSERT_EQ(kernels[0].calls, 2u);
+  ASSERT_DOUBLE_EQ(kernels[0].bytes, 2.0 * N * 24);
+  ASSERT_DOUBLE_EQ(kernels[0].flops, 2.0 * N * 2);
+  ASSERT_DOUBLE_EQ(kernels[0].intensity(), 2.0 / 24);
+
+  // RAJA_ROOFLINE_PEAK is set, so no STREAM run is needed
+  ASSERT_DOUBLE_EQ(roofline_plugin->getPeakBandwidth(), 100.0e9);
+
+  RAJA::util::finalize_plugins();
+
+  std::ifstream report(path);
+  ASSERT_TRUE(report.good());
+  std::stringstream contents;
+  contents << report.rdbuf();
+  ASSERT_NE(contents.str().find("\"roofline-daxpy\""), std::string::npos);
+  ASSERT_TRUE(roofline_plugin->getKernels().empty());
+}
+
+TEST(PluginTestRoofline, StreamTriad)
+{
+  ASSERT_GT(RAJA::util::measure_stream_triad(1 << 16, 2), 0.0);
+}
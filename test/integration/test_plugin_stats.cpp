@@ -0,0 +1,60 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "RAJA/RAJA.hpp"
+#include "RAJA_test-plugin.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+TEST(PluginTestStats, Report)
+{
+  const char* path = getenv("RAJA_STATS");
+  ASSERT_NE(path, nullptr);
+
+  auto* stats_plugin = findPlugin<RAJA::util::StatsPlugin>("StatsPlugin");
+  ASSERT_NE(stats_plugin, nullptr);
+
+  for (int i = 0; i < 3; ++i) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::Name("stats-a"),
+                                 RAJA::RangeSegment(0, 10),
+                                 [=](int) {});
+  }
+  RAJA::forall<RAJA::seq_exec>(RAJA::Name("stats-b"),
+                               RAJA::RangeSegment(0, 7),
+                               [=](int) {});
+
+  auto stats = stats_plugin->getStats();
+  ASSERT_EQ(stats.size(), 2u);
+
+  for (auto const& s : stats) {
+    ASSERT_LE(s.min_time, s.max_time);
+    ASSERT_LE(s.max_time, s.total_time);
+    if (s.kernel_name == "stats-a") {
+      ASSERT_EQ(s.calls, 3u);
+      ASSERT_EQ(s.iterations, 30u);
+    } else {
+      ASSERT_EQ(s.kernel_name, "stats-b");
+      ASSERT_EQ(s.calls, 1u);
+      ASSERT_EQ(s.iterations, 7u);
+    }
+  }
+  ASSERT_GE(stats[0].total_time, stats[1].total_time);
+
+  RAJA::util::finalize_plugins();
+
+  std::ifstream report(path);
+  ASSERT_TRUE(report.good());
+  std::stringstream contents;
+  contents << report.rdbuf();
+  ASSERT_NE(contents.str().find("\"kernel\": \"stats-a\""), std::string::npos);
+  ASSERT_NE(contents.str().find("\"calls\": 3"), std::string::npos);
+
+  ASSERT_TRUE(stats_plugin->getStats().empty());
+}
@@ -0,0 +1,57 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "RAJA/RAJA.hpp"
+#include "RAJA_test-plugin.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+TEST(PluginTestTrace, Timeline)
+{
+  const char* path = getenv("RAJA_TRACE");
+  ASSERT_NE(path, nullptr);
+
+  auto* trace_plugin = findPlugin<RAJA::util::TracePlugin>("TracePlugin");
+  ASSERT_NE(trace_plugin, nullptr);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::Name("trace-forall"),
+                               RAJA::RangeSegment(0, 10),
+                               [=](int) {});
+
+  {
+    // the name only has to outlive the kernel
+    std::string name = "trace-temporary";
+    RAJA::forall<RAJA::seq_exec>(RAJA::Name(name.c_str()),
+                                 RAJA::RangeSegment(0, 5),
+                                 [=](int) {});
+    name.assign(name.size(), 'x');
+  }
+
+  int values[] = {3, 1, 2};
+  RAJA::sort<RAJA::seq_exec>(values, values + 3);
+  RAJA::inclusive_scan_inplace<RAJA::seq_exec>(values, values + 3);
+
+  ASSERT_EQ(trace_plugin->numEvents(), 4u);
+
+  RAJA::util::finalize_plugins();
+
+  ASSERT_EQ(trace_plugin->numEvents(), 0u);
+
+  std::ifstream trace(path);
+  ASSERT_TRUE(trace.good());
+  std::stringstream contents;
+  contents << trace.rdbuf();
+  ASSERT_NE(contents.str().find("\"traceEvents\""), std::string::npos);
+  ASSERT_NE(contents.str().find("\"name\": \"trace-forall\""), std::string::npos);
+  ASSERT_NE(contents.str().find("\"name\": \"trace-temporary\""),
+            std::string::npos);
+  ASSERT_NE(contents.str().find("\"iterations\": 10"), std::string::npos);
+  ASSERT_NE(contents.str().find("\"iterations\": 3"), std::string::npos);
+}
@@ -1370,6 +1370,431 @@ TEST(Kernel, CollapseSeq)
   delete[] x;
 }
 
+TEST(Kernel, CollapseMorton)
+{
+  using namespace RAJA;
+
+  using Pol = KernelPolicy<
+      Collapse<morton_collapse_exec, ArgList<0, 1, 2>, Lambda<0>>>;
+
+  constexpr int N = 5, M = 7, K = 11;
+
+  // curve order matches the storage order of a MortonLayout
+  MortonLayout<3> layout(N, M, K);
+
+  int *x = new int[N * M * K];
+  for (int i = 0; i < N * M * K; ++i) {
+    x[i] = 0;
+  }
+
+  Index_type last = -1;
+  int ordered = 1;
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N), RangeSegment(0, M), RangeSegment(0, K)),
+
+      [&](Index_type i, Index_type j, Index_type k) {
+        x[(i * M + j) * K + k] += 1;
+        ordered &= layout(i, j, k) > last;
+        last = layout(i, j, k);
+      });
+
+  ASSERT_EQ(ordered, 1);
+  for (int i = 0; i < N * M * K; ++i) {
+    ASSERT_EQ(x[i], 1);
+  }
+
+  delete[] x;
+}
+
+TEST(Kernel, CollapseHilbert)
+{
+  using namespace RAJA;
+
+  using Pol = KernelPolicy<
+      Collapse<hilbert_collapse_exec, ArgList<1, 0>, Lambda<0>>>;
+
+  constexpr int N = 13, M = 6;
+
+  int *x = new int[N * M];
+  for (int i = 0; i < N * M; ++i) {
+    x[i] = 0;
+  }
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N), RangeSegment(0, M)),
+
+      [=](Index_type i, Index_type j) { x[i * M + j] += 1; });
+
+  for (int i = 0; i < N * M; ++i) {
+    ASSERT_EQ(x[i], 1);
+  }
+
+  delete[] x;
+}
+
+TEST(Kernel, TileAutoTranspose)
+{
+  using namespace RAJA;
+
+  // tiles of both loops sized so a tile of A and At fits in L1
+  using tile_t = tile_auto<1, 2, double, double>;
+
+  using Pol = KernelPolicy<
+      statement::Tile<1, tile_t, loop_exec,
+        statement::Tile<0, tile_t, loop_exec,
+          For<1, loop_exec, For<0, loop_exec, Lambda<0>>>>>>;
+
+  ASSERT_GE(tile_t::chunk_size(), 1);
+
+  constexpr int N = 301, M = 517;
+
+  double *a = new double[N * M];
+  double *at = new double[M * N];
+  for (int i = 0; i < N * M; ++i) {
+    a[i] = i;
+    at[i] = -1.0;
+  }
+
+  View<double, Layout<2>> av(a, N, M);
+  View<double, Layout<2>> atv(at, M, N);
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N), RangeSegment(0, M)),
+
+      [=](Index_type i, Index_type j) { atv(j, i) = av(i, j); });
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      ASSERT_EQ(atv(j, i), av(i, j));
+    }
+  }
+
+  delete[] a;
+  delete[] at;
+}
+
+template <typename ExecPolicy, typename ReducePolicy>
+void test_recursive_tile()
+{
+  using namespace RAJA;
+
+  using Pol = KernelPolicy<
+      statement::RecursiveTile<ArgList<0, 1>, 16, ExecPolicy,
+        For<0, loop_exec, For<1, loop_exec,
+          Lambda<0, Segs<0, 1>, Offsets<0, 1>>>>>>;
+
+  constexpr int N = 301, M = 77;
+
+  double *a = new double[N * M];
+  double *at = new double[M * N];
+  for (int i = 0; i < N * M; ++i) {
+    a[i] = i;
+    at[i] = -1.0;
+  }
+
+  View<double, Layout<2>> av(a, N, M);
+  View<double, Layout<2>> atv(at, M, N);
+
+  ReduceSum<ReducePolicy, long> trip_count(0);
+  ReduceMax<ReducePolicy, long> max_block(0);
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N), RangeSegment(0, M)),
+
+      [=](Index_type i, Index_type j, Index_type bi, Index_type bj) {
+        atv(j, i) = av(i, j);
+        trip_count += 1;
+        max_block.max(bi > bj ? bi + 1 : bj + 1);
+      });
+
+  // the blocks cover the iteration space exactly once, and are no larger
+  // than the cutoff in either dimension
+  ASSERT_EQ((long)trip_count, (long)N * M);
+  ASSERT_GT((long)max_block, 0);
+  ASSERT_LE((long)max_block, 16);
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      ASSERT_EQ(atv(j, i), av(i, j));
+    }
+  }
+
+  delete[] a;
+  delete[] at;
+}
+
+TEST(Kernel, RecursiveTileSeq)
+{
+  test_recursive_tile<RAJA::seq_exec, RAJA::seq_reduce>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(Kernel, RecursiveTileOmpTask)
+{
+  test_recursive_tile<RAJA::omp_parallel_task_exec, RAJA::omp_reduce>();
+}
+#endif
+
+TEST(Kernel, Unroll)
+{
+  using namespace RAJA;
+
+  using Pol = KernelPolicy<
+      For<1, loop_exec, statement::Unroll<0, 4, Lambda<0>>>>;
+
+  // lengths below, at and above multiples of the factor
+  for (int N = 0; N < 11; ++N) {
+    std::vector<int> order;
+    std::vector<int> *order_ptr = &order;
+
+    kernel<Pol>(
+
+        RAJA::make_tuple(RangeSegment(3, 3 + N), RangeSegment(0, 2)),
+
+        [=](Index_type i, Index_type j) { order_ptr->push_back(j * 100 + i); });
+
+    ASSERT_EQ(order.size(), size_t(2 * N));
+    for (int j = 0, k = 0; j < 2; ++j) {
+      for (int i = 3; i < 3 + N; ++i, ++k) {
+        ASSERT_EQ(order[k], j * 100 + i);
+      }
+    }
+  }
+}
+
+TEST(Kernel, UnrollJam)
+{
+  using namespace RAJA;
+
+  using Pol = KernelPolicy<statement::UnrollJam<0, 1, 3, Lambda<0>>>;
+
+  constexpr int N = 7, M = 5;
+
+  std::vector<int> order;
+  std::vector<int> *order_ptr = &order;
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N), RangeSegment(0, M)),
+
+      [=](Index_type i, Index_type j) { order_ptr->push_back(i * 100 + j); });
+
+  // rows 0-2 and 3-5 are jammed, row 6 is the remainder
+  std::vector<int> expected;
+  for (int i0 = 0; i0 + 3 <= N; i0 += 3) {
+    for (int j = 0; j < M; ++j) {
+      for (int i = i0; i < i0 + 3; ++i) {
+        expected.push_back(i * 100 + j);
+      }
+    }
+  }
+  for (int j = 0; j < M; ++j) {
+    expected.push_back(6 * 100 + j);
+  }
+
+  ASSERT_EQ(order, expected);
+}
+
+TEST(Kernel, PrefetchGather)
+{
+  using namespace RAJA;
+
+  using Pol = KernelPolicy<
+      For<0, loop_exec,
+        statement::Prefetch<0, statement::Param<0>, 8>,
+        Lambda<0>>>;
+
+  constexpr int N = 1000;
+
+  std::vector<Index_type> idx(N);
+  for (int i = 0; i < N; ++i) {
+    idx[i] = (i * 577) % N;
+  }
+
+  camp::resources::Resource host_res{camp::resources::Host()};
+  TypedListSegment<Index_type> list(&idx[0], N, host_res);
+
+  std::vector<double> x(N), y(N, 0.0);
+  for (int i = 0; i < N; ++i) {
+    x[i] = i;
+  }
+  double *yp = &y[0];
+
+  kernel_param<Pol>(
+
+      RAJA::make_tuple(list),
+
+      RAJA::make_tuple(&x[0]),
+
+      [=](Index_type i, double *xp) { yp[i] = 2.0 * xp[i]; });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(y[i], 2.0 * i);
+  }
+}
+
+TEST(Kernel, MixedLayoutView)
+{
+  using namespace RAJA;
+
+  using Pol = KernelPolicy<
+      For<0, loop_exec, For<1, loop_exec, For<2, simd_exec, Lambda<0>>>>>;
+
+  constexpr int N = 13;
+
+  // runtime element count, 8 corners x 3 components known at compile time
+  using layout_t = MixedLayout<dynamic_extent, 8, 3>;
+
+  int *x = new int[N * 8 * 3];
+  View<int, layout_t> xv(x, N);
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N), RangeSegment(0, 8), RangeSegment(0, 3)),
+
+      [=](Index_type e, Index_type c, Index_type d) {
+        xv(e, c, d) = static_cast<int>((e * 8 + c) * 3 + d);
+      });
+
+  for (int i = 0; i < N * 8 * 3; ++i) {
+    ASSERT_EQ(x[i], i);
+  }
+
+  delete[] x;
+}
+
+TEST(Kernel, VectorExec)
+{
+  using namespace RAJA;
+
+  using vector_t = NativeVector<double>;
+  using vindex_t = VectorIndex<Index_type, vector_t>;
+
+  using Pol = KernelPolicy<
+      For<0, loop_exec, For<1, vector_exec<vector_t>, Lambda<0>>>>;
+
+  // inner extent with a partial vector
+  constexpr int N = 5;
+  constexpr int M = 2 * vector_t::width + 1;
+
+  double *a = new double[N * M];
+  double *b = new double[N * M];
+  for (int i = 0; i < N * M; ++i) {
+    a[i] = i;
+    b[i] = -1.0;
+  }
+
+  View<double, Layout<2>> av(a, N, M);
+  View<double, Layout<2>> bv(b, N, M);
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N), RangeSegment(0, M)),
+
+      [=](Index_type i, vindex_t j) { bv(i, j) = av(i, j) * 2.0 + 1.0; });
+
+  for (int i = 0; i < N * M; ++i) {
+    ASSERT_EQ(b[i], 2.0 * i + 1.0);
+  }
+
+  delete[] a;
+  delete[] b;
+}
+
+TEST(Kernel, VectorExecStrided)
+{
+  using namespace RAJA;
+
+  using vector_t = NativeVector<double>;
+  using vindex_t = VectorIndex<Index_type, vector_t>;
+
+  using Pol = KernelPolicy<
+      For<0, loop_exec, For<1, vector_exec<vector_t>, Lambda<0>>>>;
+
+  constexpr int N = 3;
+  constexpr int M = 4 * vector_t::width + 1;
+
+  double *a = new double[N * M];
+  for (int i = 0; i < N * M; ++i) {
+    a[i] = 0.0;
+  }
+
+  View<double, Layout<2>> av(a, N, M);
+
+  // every other column: executed one column at a time
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N), RangeStrideSegment(0, M, 2)),
+
+      [=](Index_type i, vindex_t j) {
+        ASSERT_EQ(1, j.size());
+        av(i, j) += 1.0;
+      });
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      ASSERT_EQ(av(i, j), j % 2 == 0 ? 1.0 : 0.0);
+    }
+  }
+
+  delete[] a;
+}
+
+TEST(Kernel, SimdReduce)
+{
+  using namespace RAJA;
+
+  // inner extent that is not a multiple of the lane count
+  constexpr int N = 17;
+  constexpr int M = 3 * simd_lanes + 5;
+
+  double *a = new double[N * M];
+  double ref_sum = 0.0;
+  for (int i = 0; i < N * M; ++i) {
+    a[i] = i % 11;
+    ref_sum += a[i];
+  }
+
+  auto segments = RAJA::make_tuple(RangeSegment(0, N), RangeSegment(0, M));
+
+  ReduceSum<simd_reduce, double> sum(0.0);
+  ReduceMaxLoc<simd_reduce, double, Index_type> maxloc(-1.0, -1);
+
+  auto body = [=](Index_type i, Index_type j) {
+    sum += a[i * M + j];
+    maxloc.maxloc(a[i * M + j] + (i * M + j == 100 ? 20.0 : 0.0),
+                  i * M + j);
+  };
+
+  using Pol =
+      KernelPolicy<For<0, loop_exec, For<1, simd_reduce_exec, Lambda<0>>>>;
+  kernel<Pol>(segments, body);
+
+  ASSERT_EQ(ref_sum, sum.get());
+  ASSERT_EQ(21.0, maxloc.get());
+  ASSERT_EQ(100, maxloc.getLoc());
+
+#if defined(RAJA_ENABLE_OPENMP)
+  sum.reset(0.0);
+  maxloc.reset(-1.0, -1);
+
+  using OmpPol = KernelPolicy<
+      For<0, omp_parallel_for_exec, For<1, simd_reduce_exec, Lambda<0>>>>;
+  kernel<OmpPol>(segments, body);
+
+  ASSERT_EQ(ref_sum, sum.get());
+  ASSERT_EQ(21.0, maxloc.get());
+  ASSERT_EQ(100, maxloc.getLoc());
+#endif
+
+  delete[] a;
+}
+
 #if defined(RAJA_ENABLE_OPENMP)
 TEST(Kernel, Collapse2)
 {
@@ -1641,6 +2066,143 @@ TEST(Kernel, Collapse8)
   delete[] data;
 }
 
+
+TEST(Kernel, Collapse4DSchedule)
+{
+
+  int N = 3;
+  int M = 5;
+  int K = 4;
+  int P = 7;
+
+  int *data = new int[N * M * K * P];
+  for (int i = 0; i < N * M * K * P; ++i) {
+    data[i] = 0;
+  }
+
+  // every other j, in reverse
+  camp::resources::Resource host_res{camp::resources::Host()};
+  Index_type jlist[] = {4, 2, 0};
+  RAJA::TypedListSegment<Index_type> jseg(&jlist[0], 3, host_res);
+
+  using Pol = RAJA::KernelPolicy<RAJA::statement::Collapse<
+      RAJA::omp_parallel_collapse_schedule_exec<RAJA::policy::omp::Dynamic<5>>,
+      ArgList<0, 1, 2, 3>,
+      Lambda<0>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, K),
+                       jseg,
+                       RAJA::RangeSegment(0, N),
+                       RAJA::RangeSegment(0, P)),
+      [=](Index_type k, Index_type j, Index_type i, Index_type r) {
+        Index_type id = r + P * (i + N * (j + M * k));
+        data[id] += id + 1;
+      });
+
+  for (int k = 0; k < K; ++k) {
+    for (int j = 0; j < M; ++j) {
+      for (int i = 0; i < N; ++i) {
+        for (int r = 0; r < P; ++r) {
+          Index_type id = r + P * (i + N * (j + M * k));
+          ASSERT_EQ(data[id], j % 2 == 0 ? id + 1 : 0);
+        }
+      }
+    }
+  }
+
+  delete[] data;
+}
+
+
+TEST(Kernel, OmpTaskLoop)
+{
+  using namespace RAJA;
+
+  constexpr int N = 37;
+
+  int *data = new int[N * N];
+  for (int i = 0; i < N * N; ++i) {
+    data[i] = 0;
+  }
+
+  // inner loop length varies with the outer index
+  using Pol = KernelPolicy<
+      For<0, omp_taskloop_exec<2>, For<1, loop_exec, Lambda<0>>>>;
+
+  ReduceSum<omp_reduce, long> trip_count(0);
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N), RangeSegment(0, N)),
+
+      [=](Index_type i, Index_type j) {
+        if (j <= i) {
+          data[i * N + j] += 1;
+          trip_count += 1;
+        }
+      });
+
+  ASSERT_EQ((long)trip_count, (long)N * (N + 1) / 2);
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < N; ++j) {
+      ASSERT_EQ(data[i * N + j], j <= i ? 1 : 0);
+    }
+  }
+
+  delete[] data;
+}
+
+
+TEST(Kernel, OmpTask)
+{
+  using namespace RAJA;
+
+  constexpr int N = 23;
+  constexpr int M = 50;
+
+  long *data = new long[N * M];
+  long *row_sum = new long[N];
+  for (int i = 0; i < N * M; ++i) {
+    data[i] = -1;
+  }
+
+  // one task per row, then once the tasks are done a sequential pass over
+  // their results
+  using Pol = KernelPolicy<
+      statement::Region<omp_task_region,
+        For<0, seq_exec,
+          statement::Task<For<1, loop_exec, Lambda<0>>>>,
+        statement::TaskWait,
+        For<0, seq_exec, Lambda<1>>>>;
+
+  ReduceSum<omp_reduce, long> total(0);
+
+  kernel<Pol>(
+
+      RAJA::make_tuple(RangeSegment(0, N), RangeSegment(0, M)),
+
+      [=](Index_type i, Index_type j) { data[i * M + j] = i * j; },
+
+      [=](Index_type i, Index_type) {
+        row_sum[i] = 0;
+        for (int j = 0; j < M; ++j) {
+          row_sum[i] += data[i * M + j];
+        }
+        total += row_sum[i];
+      });
+
+  long expected = 0;
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(row_sum[i], (long)i * M * (M - 1) / 2);
+    expected += row_sum[i];
+  }
+  ASSERT_EQ((long)total, expected);
+
+  delete[] data;
+  delete[] row_sum;
+}
+
 #endif  // RAJA_ENABLE_OPENMP
 
 
@@ -2714,6 +3276,83 @@ TEST(Kernel, Hyperplane_seq)
 }
 
 
+template <typename ExecPolicy, typename ReducePolicy>
+void test_hyperplane_3d()
+{
+  using namespace RAJA;
+
+  using Pol = KernelPolicy<
+      Hyperplane<1, seq_exec, ArgList<0, 2>, ExecPolicy, Lambda<0>>>;
+
+  constexpr long N = (long)7;
+  constexpr long M = (long)13;
+  constexpr long O = (long)5;
+
+  long *x = new long[N * M * O];
+
+  using myview = View<long, Layout<3, RAJA::Index_type>>;
+  myview xv{x, N, M, O};
+
+  RAJA::ReduceSum<ReducePolicy, long> trip_count(0);
+  RAJA::ReduceSum<ReducePolicy, long> oob_count(0);
+
+  // j is iterated backwards, and only every other k is used
+  kernel<Pol>(
+      RAJA::make_tuple(RangeSegment(0, N),
+                       RangeStrideSegment(M - 1, -1, -1),
+                       RangeStrideSegment(0, 2 * O, 2)),
+      [=](Index_type i, Index_type j, Index_type k2) {
+        Index_type k = k2 / 2;
+        if (i < 0 || i >= N || j < 0 || j >= M || k < 0 || k >= O) {
+          oob_count += 1;
+          return;
+        }
+
+        long left = i > 0 ? xv(i - 1, j, k) : 1;
+        long down = j < M - 1 ? xv(i, j + 1, k) : 1;
+        long back = k > 0 ? xv(i, j, k - 1) : 1;
+
+        xv(i, j, k) = left + down + back;
+
+        trip_count += 1;
+      });
+
+  ASSERT_EQ((long)trip_count, N * M * O);
+  ASSERT_EQ((long)oob_count, 0);
+
+  for (long i = 0; i < N; ++i) {
+    for (long j = 0; j < M; ++j) {
+      for (long k = 0; k < O; ++k) {
+        long left = i > 0 ? xv(i - 1, j, k) : 1;
+        long down = j < M - 1 ? xv(i, j + 1, k) : 1;
+        long back = k > 0 ? xv(i, j, k - 1) : 1;
+        ASSERT_EQ(xv(i, j, k), left + down + back);
+      }
+    }
+  }
+
+  delete[] x;
+}
+
+TEST(Kernel, Hyperplane_seq_3d)
+{
+  test_hyperplane_3d<RAJA::seq_exec, RAJA::seq_reduce>();
+}
+
+// curve collapse policies run each hyperplane as a loop_exec loop
+TEST(Kernel, Hyperplane_morton_3d)
+{
+  test_hyperplane_3d<RAJA::morton_collapse_exec, RAJA::seq_reduce>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(Kernel, Hyperplane_omp_3d)
+{
+  test_hyperplane_3d<RAJA::omp_parallel_collapse_exec, RAJA::omp_reduce>();
+}
+#endif
+
+
 #if defined(RAJA_ENABLE_CUDA)
 
 
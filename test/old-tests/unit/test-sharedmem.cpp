@@ -484,6 +484,30 @@ using SeqTypes =
         >//for 3
       > //kernel policy
     > //list
+  ,RAJA::list<
+    RAJA::KernelPolicy<
+        RAJA::statement::For<3, RAJA::loop_exec,
+          RAJA::statement::For<2, RAJA::loop_exec,
+
+          RAJA::statement::InitLocalMem<RAJA::cpu_arena_mem, RAJA::ParamList<0,1>,
+
+              //Load data into arena memory
+              RAJA::statement::For<1, RAJA::loop_exec,
+                RAJA::statement::For<0, RAJA::loop_exec,
+                  RAJA::statement::Lambda<0>
+                                   >
+                                 >,
+
+                //Read data from arena memory
+                RAJA::statement::For<1, RAJA::loop_exec,
+                  RAJA::statement::For<0, RAJA::loop_exec,
+                    RAJA::statement::Lambda<1> > >
+
+              > //close arena memory scope
+            >//for 2
+        >//for 3
+      > //kernel policy
+    > //list
   >; //types
 INSTANTIATE_TYPED_TEST_SUITE_P(Seq, MatTranspose, SeqTypes);
 INSTANTIATE_TYPED_TEST_SUITE_P(Seq, TypedLocalMem, SeqTypes);
@@ -590,6 +614,60 @@ using TestTypes =
        >//outer collapsed
       > //close policy list
      > //close list
+  ,RAJA::list<
+    RAJA::KernelPolicy<
+      RAJA::statement::For<3, RAJA::omp_parallel_for_exec,
+        RAJA::statement::For<2, RAJA::loop_exec,
+
+          RAJA::statement::InitLocalMem<RAJA::cpu_arena_mem, RAJA::ParamList<0,1>,
+
+           //Load data into arena memory
+           RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::For<0, RAJA::loop_exec,
+                RAJA::statement::Lambda<0>
+              >
+             >,
+
+           //Read data from arena memory
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::For<0, RAJA::loop_exec,
+                RAJA::statement::Lambda<1>
+           >
+          >
+         > //close arena mem window
+        > //2
+       >//3
+      > //close policy list
+     > //close list
+  ,RAJA::list<
+    RAJA::KernelPolicy<
+      RAJA::statement::Region<RAJA::omp_parallel_region,
+        RAJA::statement::For<3, RAJA::loop_exec,
+          RAJA::statement::For<2, RAJA::loop_exec,
+
+            RAJA::statement::InitLocalMem<RAJA::cpu_team_shared_mem, RAJA::ParamList<0,1>,
+
+             //Load data into team shared memory
+             RAJA::statement::For<1, RAJA::omp_for_nowait_exec,
+                RAJA::statement::For<0, RAJA::loop_exec,
+                  RAJA::statement::Lambda<0>
+                >
+               >,
+
+             RAJA::statement::OmpSyncThreads,
+
+             //Read data from team shared memory
+              RAJA::statement::For<0, RAJA::omp_for_nowait_exec,
+                RAJA::statement::For<1, RAJA::loop_exec,
+                  RAJA::statement::Lambda<1>
+             >
+            >
+           > //close team shared mem window
+          > //2
+         >//3
+        > //close region
+      > //close policy list
+     > //close list
    >;
 
 
@@ -48,6 +48,63 @@ TEST(SIMD, Align)
   RAJA::free_aligned(b);
 }
 
+TEST(SIMD, ReduceExec)
+{
+  // not a multiple of the lane count
+  const int N = 5 * RAJA::simd_lanes + 3;
+  double *a = new double[N];
+  for (int i = 0; i < N; ++i) {
+    a[i] = i % 7;
+  }
+
+  RAJA::ReduceSum<RAJA::simd_reduce, double> sum(0.0);
+  RAJA::ReduceMinLoc<RAJA::simd_reduce, double> minloc(100.0, -1);
+
+  RAJA::forall<RAJA::simd_reduce_exec>(RAJA::RangeSegment(0, N), [=](int i) {
+    sum += a[i];
+    minloc.minloc(i == N - 1 ? -1.0 : a[i], i);
+  });
+
+  double ref_sum = 0.0;
+  for (int i = 0; i < N; ++i) {
+    ref_sum += a[i];
+  }
+  ASSERT_EQ(ref_sum, sum.get());
+  ASSERT_EQ(-1.0, minloc.get());
+  ASSERT_EQ(N - 1, minloc.getLoc());
+
+  delete[] a;
+}
+
+struct CountCopies {
+  static int copies;
+
+  CountCopies() = default;
+  CountCopies(CountCopies const &) { ++copies; }
+
+  void operator()(int) const {}
+};
+
+int CountCopies::copies = 0;
+
+TEST(SIMD, CopiesOnlyInReduceExec)
+{
+  CountCopies::copies = 0;
+  RAJA::forall<RAJA::loop_exec>(RAJA::RangeSegment(0, 64), CountCopies{});
+  const int loop_copies = CountCopies::copies;
+
+  // simd_exec runs the loop body in place, reducers or not
+  RAJA::ReduceSum<RAJA::simd_reduce, int> sum(0);
+  CountCopies::copies = 0;
+  RAJA::forall<RAJA::simd_exec>(RAJA::RangeSegment(0, 64), CountCopies{});
+  ASSERT_EQ(loop_copies, CountCopies::copies);
+
+  CountCopies::copies = 0;
+  RAJA::forall<RAJA::simd_reduce_exec>(RAJA::RangeSegment(0, 64),
+                                       CountCopies{});
+  ASSERT_EQ(loop_copies + RAJA::simd_lanes, CountCopies::copies);
+}
+
 #if defined(RAJA_ENABLE_OPENMP)
 TEST(SIMD, OMPAndSimd)
 {
@@ -20,7 +20,8 @@ using DataTypeList = camp::list< int,
                                  float,
                                  double >;
 
-using SequentialReducerPolicyList = camp::list< RAJA::seq_reduce >;
+using SequentialReducerPolicyList = camp::list< RAJA::seq_reduce,
+                                                RAJA::simd_reduce >;
 
 #if defined(RAJA_ENABLE_TBB)
 using TBBReducerPolicyList = camp::list< RAJA::tbb_reduce >;
@@ -0,0 +1,164 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for AoSoA
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/AoSoA.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+struct Particle {
+  double x;
+  float v;
+  int id;
+};
+
+using particles_type = RAJA::AoSoA<camp::tuple<double, float, int>, 4>;
+
+}  // namespace
+
+TEST(AoSoAUnitTest, Sizes)
+{
+  particles_type p(10);
+
+  ASSERT_TRUE(p.allocated());
+  ASSERT_EQ(10u, p.size());
+  ASSERT_EQ(3u, p.num_blocks());
+  ASSERT_EQ(12u, p.padded_size());
+  ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(p.data()) % 64);
+
+  // padding lanes are zero initialized
+  for (size_t i = 0; i < p.padded_size(); ++i) {
+    ASSERT_EQ(0.0, p.get<0>(i));
+    ASSERT_EQ(0, p.get<2>(i));
+  }
+
+  p.deallocate();
+  ASSERT_FALSE(p.allocated());
+  ASSERT_EQ(0u, p.size());
+}
+
+TEST(AoSoAUnitTest, BlockLayout)
+{
+  particles_type p(9);
+
+  for (size_t i = 0; i < p.size(); ++i) {
+    p.get<0>(i) = 1.5 * i;
+    p.get<1>(i) = 0.5f * i;
+    p.get<2>(i) = static_cast<int>(i);
+  }
+
+  auto x = p.view<0>();
+  auto id = p.view<2>();
+
+  for (size_t b = 0; b < p.num_blocks(); ++b) {
+    // the lanes of a field are contiguous within a block
+    double* xb = x.lanes(b);
+    int* idb = id.lanes(b);
+    for (size_t l = 0; l < particles_type::vector_length; ++l) {
+      size_t i = b * particles_type::vector_length + l;
+      if (i < p.size()) {
+        ASSERT_EQ(1.5 * i, xb[l]);
+        ASSERT_EQ(static_cast<int>(i), idb[l]);
+        ASSERT_EQ(&x(i), &xb[l]);
+        ASSERT_EQ(&x(b, l), &xb[l]);
+      }
+    }
+    // all fields of a block are in the same block_type object
+    ASSERT_EQ(reinterpret_cast<char*>(p.data() + b),
+              reinterpret_cast<char*>(xb));
+  }
+}
+
+TEST(AoSoAUnitTest, Tuple)
+{
+  particles_type p(5);
+
+  p.set_tuple(3, camp::tuple<double, float, int>(2.0, 3.0f, 4));
+
+  auto t = p.get_tuple(3);
+  ASSERT_EQ(2.0, camp::get<0>(t));
+  ASSERT_EQ(3.0f, camp::get<1>(t));
+  ASSERT_EQ(4, camp::get<2>(t));
+  ASSERT_EQ(4, p.view<2>()(3));
+}
+
+TEST(AoSoAUnitTest, ConvertAoS)
+{
+  const size_t N = 13;
+  std::vector<Particle> aos(N);
+  for (size_t i = 0; i < N; ++i) {
+    aos[i] = Particle{0.25 * i, 2.0f * i, static_cast<int>(N - i)};
+  }
+
+  particles_type p(N);
+  p.copy_from_aos(aos.data(), &Particle::x, &Particle::v, &Particle::id);
+
+  for (size_t i = 0; i < N; ++i) {
+    ASSERT_EQ(aos[i].x, p.get<0>(i));
+    ASSERT_EQ(aos[i].v, p.get<1>(i));
+    ASSERT_EQ(aos[i].id, p.get<2>(i));
+  }
+
+  std::vector<Particle> out(N, Particle{-1.0, -1.0f, -1});
+  p.copy_to_aos(out.data(), &Particle::x, &Particle::v, &Particle::id);
+
+  for (size_t i = 0; i < N; ++i) {
+    ASSERT_EQ(aos[i].x, out[i].x);
+    ASSERT_EQ(aos[i].v, out[i].v);
+    ASSERT_EQ(aos[i].id, out[i].id);
+  }
+}
+
+TEST(AoSoAUnitTest, ConvertSoA)
+{
+  const size_t N = 7;
+  std::vector<double> x(N);
+  std::vector<float> v(N);
+  std::vector<int> id(N);
+  for (size_t i = 0; i < N; ++i) {
+    x[i] = 3.0 * i;
+    v[i] = 1.0f + i;
+    id[i] = static_cast<int>(i * i);
+  }
+
+  particles_type p(N);
+  p.copy_from_soa(x.data(), v.data(), id.data());
+
+  std::vector<double> x2(N);
+  std::vector<float> v2(N);
+  std::vector<int> id2(N);
+  p.copy_to_soa(x2.data(), v2.data(), id2.data());
+
+  ASSERT_EQ(x, x2);
+  ASSERT_EQ(v, v2);
+  ASSERT_EQ(id, id2);
+}
+
+TEST(AoSoAUnitTest, Move)
+{
+  particles_type p(6);
+  p.get<2>(5) = 42;
+
+  particles_type q(std::move(p));
+  ASSERT_FALSE(p.allocated());
+  ASSERT_EQ(6u, q.size());
+  ASSERT_EQ(42, q.get<2>(5));
+
+  particles_type r;
+  r = std::move(q);
+  ASSERT_FALSE(q.allocated());
+  ASSERT_EQ(42, r.get<2>(5));
+}
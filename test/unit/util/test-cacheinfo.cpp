@@ -0,0 +1,59 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for CacheInfo
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/CacheInfo.hpp"
+
+TEST(CacheInfoUnitTest, Sizes)
+{
+  RAJA::util::CacheInfo const& info = RAJA::util::cache_info();
+
+  ASSERT_GT(info.line_bytes, 0u);
+  ASSERT_GT(RAJA::util::cache_size(1), 0u);
+
+  // each level is at least as large as the one before it
+  ASSERT_GE(RAJA::util::cache_size(2), RAJA::util::cache_size(1));
+  ASSERT_GE(RAJA::util::cache_size(3), RAJA::util::cache_size(2));
+
+  // out of range levels are clamped
+  ASSERT_EQ(RAJA::util::cache_size(0), RAJA::util::cache_size(1));
+  ASSERT_EQ(RAJA::util::cache_size(7), RAJA::util::cache_size(3));
+}
+
+TEST(CacheInfoUnitTest, TileExtent)
+{
+  for (int level = 1; level <= 3; ++level) {
+    size_t const half = RAJA::util::cache_size(level) / 2;
+
+    for (int dims = 1; dims <= 3; ++dims) {
+      for (size_t bytes : {4u, 8u, 24u}) {
+        size_t const extent =
+            RAJA::util::cache_tile_extent(level, dims, bytes);
+
+        ASSERT_GE(extent, 1u);
+        if (extent >= 16) {
+          ASSERT_EQ(extent % 8, 0u);
+        }
+
+        size_t points = 1;
+        for (int d = 0; d < dims; ++d) {
+          points *= extent;
+        }
+        ASSERT_LE(points * bytes, half > bytes ? half : bytes);
+      }
+    }
+  }
+
+  // a larger footprint never gives a larger tile
+  ASSERT_LE(RAJA::util::cache_tile_extent(1, 2, 32),
+            RAJA::util::cache_tile_extent(1, 2, 8));
+}
@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for FastDivisor
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/FastDivisor.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+template <typename T>
+class FastDivisorUnitTest : public ::testing::Test
+{
+};
+
+using FastDivisorTypes = ::testing::Types<int,
+                                          unsigned int,
+                                          long,
+                                          unsigned long,
+                                          long long,
+                                          unsigned long long>;
+
+TYPED_TEST_SUITE(FastDivisorUnitTest, FastDivisorTypes);
+
+TYPED_TEST(FastDivisorUnitTest, SmallDivisors)
+{
+  using T = TypeParam;
+
+  for (T d = 1; d < 300; ++d) {
+    RAJA::FastDivisor<T> fd(d);
+    for (T n = 0; n < 3000; ++n) {
+      ASSERT_EQ(n / d, n / fd);
+      ASSERT_EQ(n % d, n % fd);
+    }
+  }
+}
+
+TYPED_TEST(FastDivisorUnitTest, LargeValues)
+{
+  using T = TypeParam;
+
+  // numerators and divisors are limited to the non-negative signed range
+  const T max = static_cast<T>(
+      std::numeric_limits<typename std::make_signed<T>::type>::max());
+  const T divisors[] = {3, 7, 10, 641, 65535, 65537, max / 3, max / 2 + 1, max};
+  const T numerators[] = {0, 1, max / 7, max / 2, max - 1, max};
+
+  for (T d : divisors) {
+    RAJA::FastDivisor<T> fd(d);
+    for (T n : numerators) {
+      ASSERT_EQ(n / d, fd.divide(n));
+      ASSERT_EQ(n % d, fd.modulo(n));
+    }
+  }
+}
+
+TEST(FastDivisorConstexprUnitTest, Constexpr)
+{
+  constexpr RAJA::FastDivisor<RAJA::Index_type> fd(7);
+
+  ASSERT_EQ(14, RAJA::Index_type(100) / fd);
+  ASSERT_EQ(2, RAJA::Index_type(100) % fd);
+}
+
+TEST(FastDivisorConversionUnitTest, ReusesMagicOfSameWidth)
+{
+  const int divisors[] = {1, 3, 7, 641, 65537};
+
+  for (int d : divisors) {
+    RAJA::FastDivisor<int> fd(d);
+
+    RAJA::FastDivisor<unsigned int> same_width(fd);
+    ASSERT_EQ(fd.magic, same_width.magic);
+    ASSERT_EQ(fd.shift, same_width.shift);
+
+    RAJA::FastDivisor<long long> wider(fd);
+    ASSERT_EQ(RAJA::FastDivisor<long long>(d).magic, wider.magic);
+
+    for (int n = 0; n < 1000; ++n) {
+      ASSERT_EQ(unsigned(n / d), unsigned(n) / same_width);
+      ASSERT_EQ(n % d, (long long)(n) % wider);
+    }
+  }
+}
@@ -0,0 +1,72 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for forall_prefetch
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+TEST(PrefetchUnitTest, Address)
+{
+  double data[8] = {0};
+  RAJA::View<double, RAJA::Layout<1>> view(data, 8);
+
+  ASSERT_EQ(RAJA::util::prefetch_address(data, 5), &data[5]);
+  ASSERT_EQ(RAJA::util::prefetch_address(view, 5), &data[5]);
+}
+
+template <typename ExecPolicy, camp::idx_t Distance>
+void test_forall_prefetch_gather()
+{
+  constexpr int N = 1000;
+
+  std::vector<RAJA::Index_type> idx(N);
+  for (int i = 0; i < N; ++i) {
+    idx[i] = (i * 577) % N;
+  }
+
+  camp::resources::Resource host_res{camp::resources::Host()};
+  RAJA::TypedListSegment<RAJA::Index_type> list(&idx[0], N, host_res);
+
+  std::vector<double> x(N), y(N, 1.0);
+  for (int i = 0; i < N; ++i) {
+    x[i] = i;
+  }
+  double *xp = &x[0];
+  RAJA::View<double, RAJA::Layout<1>> yv(&y[0], N);
+
+  RAJA::forall_prefetch<ExecPolicy, Distance>(
+      list, RAJA::make_tuple(xp, yv), [=](RAJA::Index_type i) {
+        yv(i) += 2.0 * xp[i];
+      });
+
+  // every index of the list is visited once
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(y[i], 1.0 + 2.0 * i);
+  }
+}
+
+TEST(PrefetchUnitTest, ForallSeq)
+{
+  test_forall_prefetch_gather<RAJA::loop_exec, 0>();
+  test_forall_prefetch_gather<RAJA::loop_exec, 1>();
+  test_forall_prefetch_gather<RAJA::loop_exec, 16>();
+  // distance longer than the segment
+  test_forall_prefetch_gather<RAJA::loop_exec, 4096>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(PrefetchUnitTest, ForallOpenMP)
+{
+  test_forall_prefetch_gather<RAJA::omp_parallel_for_exec, 16>();
+}
+#endif
@@ -0,0 +1,255 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for explicit vector types and
+/// vector_exec
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+template <typename T>
+class VectorUnitTest : public ::testing::Test
+{
+};
+
+// native widths where the target has them, plus widths that never are
+using VectorTypes = ::testing::Types<RAJA::Vector<double, 2>,
+                                     RAJA::Vector<double, 4>,
+                                     RAJA::Vector<double, 8>,
+                                     RAJA::Vector<float, 4>,
+                                     RAJA::Vector<float, 8>,
+                                     RAJA::Vector<float, 16>,
+                                     RAJA::Vector<double, 3>,
+                                     RAJA::Vector<int, 4>,
+                                     RAJA::NativeVector<double>>;
+
+TYPED_TEST_SUITE(VectorUnitTest, VectorTypes);
+
+TYPED_TEST(VectorUnitTest, LoadStore)
+{
+  using vector_t = TypeParam;
+  using T = typename vector_t::element_type;
+  constexpr camp::idx_t W = vector_t::width;
+
+  std::vector<T> a(2 * W);
+  for (camp::idx_t i = 0; i < 2 * W; ++i) {
+    a[i] = T(i + 1);
+  }
+
+  vector_t v = vector_t::load(a.data());
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_EQ(T(i + 1), v[i]);
+  }
+
+  for (camp::idx_t n = 0; n <= W; ++n) {
+    // partial loads zero the inactive lanes
+    vector_t p = vector_t::load(a.data(), n);
+    for (camp::idx_t i = 0; i < W; ++i) {
+      ASSERT_EQ(i < n ? T(i + 1) : T(0), p[i]);
+    }
+
+    // partial stores leave the memory past n untouched
+    std::vector<T> b(W, T(-1));
+    v.store(b.data(), n);
+    for (camp::idx_t i = 0; i < W; ++i) {
+      ASSERT_EQ(i < n ? T(i + 1) : T(-1), b[i]);
+    }
+  }
+
+  vector_t s = vector_t::load_strided(a.data(), 2, W);
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_EQ(T(2 * i + 1), s[i]);
+  }
+
+  std::vector<T> c(2 * W, T(0));
+  s.store_strided(c.data(), 2, W);
+  for (camp::idx_t i = 0; i < 2 * W; ++i) {
+    ASSERT_EQ(i % 2 == 0 ? T(i + 1) : T(0), c[i]);
+  }
+}
+
+TYPED_TEST(VectorUnitTest, Arithmetic)
+{
+  using vector_t = TypeParam;
+  using T = typename vector_t::element_type;
+  constexpr camp::idx_t W = vector_t::width;
+
+  vector_t a(T(0)), b(T(0));
+  for (camp::idx_t i = 0; i < W; ++i) {
+    a.set(i, T(i + 1));
+    b.set(i, T(2 * W - i));
+  }
+
+  vector_t sum = a + b;
+  vector_t diff = b - a;
+  vector_t prod = a * 2;
+  vector_t quot = b / a;
+  vector_t f = fma(a, b, vector_t(T(1)));
+  vector_t lo = min(a, b);
+  vector_t hi = max(a, b);
+  vector_t neg = -a;
+
+  vector_t acc(T(0));
+  acc += a;
+  acc *= 3;
+
+  T total = T(0);
+  for (camp::idx_t i = 0; i < W; ++i) {
+    T x = T(i + 1);
+    T y = T(2 * W - i);
+    ASSERT_EQ(x + y, sum[i]);
+    ASSERT_EQ(y - x, diff[i]);
+    ASSERT_EQ(x * 2, prod[i]);
+    ASSERT_EQ(y / x, quot[i]);
+    ASSERT_EQ(x * y + 1, f[i]);
+    ASSERT_EQ(x < y ? x : y, lo[i]);
+    ASSERT_EQ(x < y ? y : x, hi[i]);
+    ASSERT_EQ(-x, neg[i]);
+    ASSERT_EQ(3 * x, acc[i]);
+    total += x;
+  }
+  ASSERT_EQ(total, a.sum());
+}
+
+TYPED_TEST(VectorUnitTest, ForallView)
+{
+  using vector_t = TypeParam;
+  using T = typename vector_t::element_type;
+  constexpr camp::idx_t W = vector_t::width;
+
+  // a multiple of the width plus a remainder
+  const RAJA::Index_type N = 5 * W + W / 2 + 1;
+
+  std::vector<T> x(N + W), y(N + W, T(-1));
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    x[i] = T(i);
+    y[i] = T(1);
+  }
+
+  RAJA::View<const T, RAJA::Layout<1>> xv(x.data(), N);
+  RAJA::View<T, RAJA::Layout<1>> yv(y.data(), N);
+
+  RAJA::forall<RAJA::vector_exec<vector_t>>(
+      RAJA::RangeSegment(0, N),
+      [=](RAJA::VectorIndex<RAJA::Index_type, vector_t> i) {
+        yv(i) = xv(i) * T(2) + yv(i);
+      });
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    ASSERT_EQ(T(2 * i + 1), y[i]);
+  }
+  // the tail store is masked
+  for (RAJA::Index_type i = N; i < N + W; ++i) {
+    ASSERT_EQ(T(-1), y[i]);
+  }
+}
+
+TYPED_TEST(VectorUnitTest, StridedView)
+{
+  using vector_t = TypeParam;
+  using T = typename vector_t::element_type;
+  constexpr camp::idx_t W = vector_t::width;
+
+  const RAJA::Index_type N = 2 * W + 1;
+  const RAJA::Index_type M = 3;
+
+  std::vector<T> a(N * M, T(0));
+  RAJA::View<T, RAJA::Layout<2>> av(a.data(), N, M);
+
+  // vectorize over the slow index: lanes are M elements apart
+  RAJA::forall<RAJA::vector_exec<vector_t>>(
+      RAJA::RangeSegment(0, N),
+      [=](RAJA::VectorIndex<RAJA::Index_type, vector_t> i) {
+        av(i, 1) = T(1);
+        av(i, 1) += T(2);
+      });
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    for (RAJA::Index_type j = 0; j < M; ++j) {
+      ASSERT_EQ(j == 1 ? T(3) : T(0), av(i, j));
+    }
+  }
+}
+
+TYPED_TEST(VectorUnitTest, CurveLayoutView)
+{
+  using vector_t = TypeParam;
+  using T = typename vector_t::element_type;
+  constexpr camp::idx_t W = vector_t::width;
+
+  const RAJA::Index_type N = 2 * W + 1;
+  const RAJA::Index_type M = 5;
+
+  // lanes are not equally spaced along the curves: gathered and scattered
+  RAJA::MortonLayout<2> morton(N, M);
+  std::vector<T> a(morton.size(), T(0));
+  RAJA::View<T, RAJA::MortonLayout<2>> av(a.data(), morton);
+
+  RAJA::HilbertLayout<2> hilbert(N, M);
+  std::vector<T> b(hilbert.size(), T(0));
+  RAJA::View<T, RAJA::HilbertLayout<2>> bv(b.data(), hilbert);
+
+  RAJA::forall<RAJA::vector_exec<vector_t>>(
+      RAJA::RangeSegment(0, N),
+      [=](RAJA::VectorIndex<RAJA::Index_type, vector_t> i) {
+        for (RAJA::Index_type j = 0; j < M; ++j) {
+          av(i, j) = T(j + 1);
+          bv(i, j) = av(i, j);
+          bv(i, j) += T(1);
+        }
+      });
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    for (RAJA::Index_type j = 0; j < M; ++j) {
+      ASSERT_EQ(T(j + 1), av(i, j));
+      ASSERT_EQ(T(j + 2), bv(i, j));
+    }
+  }
+}
+
+TYPED_TEST(VectorUnitTest, ForallNonUnitStride)
+{
+  using vector_t = TypeParam;
+  using T = typename vector_t::element_type;
+  using vindex_t = RAJA::VectorIndex<RAJA::Index_type, vector_t>;
+  constexpr camp::idx_t W = vector_t::width;
+
+  const RAJA::Index_type N = 4 * W + 3;
+
+  std::vector<T> y(N, T(0));
+  RAJA::View<T, RAJA::Layout<1>> yv(y.data(), N);
+
+  // lanes of these segments are not consecutive: one iterate at a time
+  RAJA::forall<RAJA::vector_exec<vector_t>>(
+      RAJA::RangeStrideSegment(0, N, 2), [=](vindex_t i) {
+        ASSERT_EQ(1, i.size());
+        yv(i) += T(1);
+      });
+
+  std::vector<RAJA::Index_type> list;
+  for (RAJA::Index_type i = N - 1; i >= 0; i -= 3) {
+    list.push_back(i);
+  }
+  camp::resources::Resource host_res{camp::resources::Host()};
+  RAJA::TypedListSegment<RAJA::Index_type> lseg(&list[0],
+                                                list.size(),
+                                                host_res);
+  RAJA::forall<RAJA::vector_exec<vector_t>>(
+      lseg, [=](vindex_t i) {
+        ASSERT_EQ(1, i.size());
+        yv(i) += T(2);
+      });
+
+  for (RAJA::Index_type i = 0; i < N; ++i) {
+    const int strided = i % 2 == 0 ? 1 : 0;
+    const int listed = (N - 1 - i) % 3 == 0 ? 2 : 0;
+    ASSERT_EQ(T(strided + listed), y[i]);
+  }
+}
@@ -0,0 +1,137 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+TEST(ReducedPrecisionUnitTest, BFloat16)
+{
+  // exactly representable values round trip
+  for (float f : {0.0f, 1.0f, -2.0f, 0.5f, 256.0f, -0.09375f}) {
+    ASSERT_EQ(f, static_cast<float>(RAJA::bfloat16(f)));
+  }
+
+  // 8 bits of precision, ties to even
+  ASSERT_EQ(1.0f, static_cast<float>(RAJA::bfloat16(1.0f + 1.0f / 512)));
+  ASSERT_EQ(1.0f + 1.0f / 64,
+            static_cast<float>(RAJA::bfloat16(1.0f + 3.0f / 256)));
+
+  // exponent range of float
+  ASSERT_EQ(std::ldexp(1.0f, 100),
+            static_cast<float>(RAJA::bfloat16(std::ldexp(1.0f, 100))));
+
+  float inf = std::numeric_limits<float>::infinity();
+  ASSERT_EQ(inf, static_cast<float>(RAJA::bfloat16(inf)));
+  ASSERT_TRUE(std::isnan(static_cast<float>(
+      RAJA::bfloat16(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST(ReducedPrecisionUnitTest, Float16)
+{
+  for (float f : {0.0f, 1.0f, -2.0f, 0.5f, 65504.0f, -0.09375f}) {
+    ASSERT_EQ(f, static_cast<float>(RAJA::float16(f)));
+  }
+
+  // 11 bits of precision, ties to even
+  ASSERT_EQ(1.0f, static_cast<float>(RAJA::float16(1.0f + 1.0f / 4096)));
+  ASSERT_EQ(1.0f + 1.0f / 512,
+            static_cast<float>(RAJA::float16(1.0f + 3.0f / 2048)));
+
+  // subnormals
+  float tiny = std::ldexp(1.0f, -24);
+  ASSERT_EQ(tiny, static_cast<float>(RAJA::float16(tiny)));
+  ASSERT_EQ(3 * tiny, static_cast<float>(RAJA::float16(3 * tiny)));
+  ASSERT_EQ(0.0f, static_cast<float>(RAJA::float16(tiny / 4)));
+
+  // overflow
+  float inf = std::numeric_limits<float>::infinity();
+  ASSERT_EQ(inf, static_cast<float>(RAJA::float16(65536.0f)));
+  ASSERT_EQ(-inf, static_cast<float>(RAJA::float16(-inf)));
+  ASSERT_TRUE(std::isnan(static_cast<float>(
+      RAJA::float16(std::numeric_limits<float>::quiet_NaN()))));
+
+  // every binary16 value converts to float and back exactly
+  for (uint32_t b = 0; b < 0x10000; ++b) {
+    RAJA::float16 h;
+    h.bits = static_cast<uint16_t>(b);
+    float f = h;
+    if (!std::isnan(f)) {
+      ASSERT_EQ(h.bits, RAJA::float16(f).bits);
+    }
+  }
+}
+
+template <typename T>
+class ConvertingViewUnitTest : public ::testing::Test
+{
+};
+
+using ConvertingViewTypes =
+    ::testing::Types<float, RAJA::bfloat16, RAJA::float16>;
+
+TYPED_TEST_SUITE(ConvertingViewUnitTest, ConvertingViewTypes);
+
+TYPED_TEST(ConvertingViewUnitTest, LoadStore)
+{
+  using storage_type = TypeParam;
+
+  const int N = 4, M = 8;
+  std::vector<storage_type> data(N * M);
+
+  RAJA::ConvertingView<double, storage_type, RAJA::Layout<2>> v(data.data(),
+                                                                 N,
+                                                                 M);
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      v(i, j) = 0.25 * (i * M + j);
+    }
+  }
+
+  // small multiples of 1/4 are exact in all the storage types
+  for (int i = 0; i < N * M; ++i) {
+    ASSERT_EQ(0.25 * i, static_cast<double>(static_cast<float>(data[i])));
+  }
+
+  v(1, 1) += 2.0;
+  v(1, 2) *= 2.0;
+  v(1, 3) = v(1, 2);
+  double x = v(1, 1) - v(0, 1);
+
+  ASSERT_EQ(0.25 * 9 + 2.0, static_cast<double>(v(1, 1)));
+  ASSERT_EQ(0.25 * 10 * 2.0, static_cast<double>(v(1, 2)));
+  ASSERT_EQ(0.25 * 10 * 2.0, static_cast<double>(v(1, 3)));
+  ASSERT_EQ(0.25 * 8 + 2.0, x);
+}
+
+TYPED_TEST(ConvertingViewUnitTest, Forall)
+{
+  using storage_type = TypeParam;
+
+  const int N = 37;
+  std::vector<storage_type> xdata(N), ydata(N);
+
+  RAJA::ConvertingView<double, storage_type, RAJA::Layout<1>> x(xdata.data(),
+                                                                 N);
+  RAJA::ConvertingView<double, storage_type, RAJA::Layout<1>> y(ydata.data(),
+                                                                 N);
+
+  RAJA::forall<RAJA::simd_exec>(RAJA::RangeSegment(0, N), [=](int i) {
+    x(i) = i;
+    y(i) = 1.0;
+  });
+
+  RAJA::forall<RAJA::simd_exec>(RAJA::RangeSegment(0, N),
+                                [=](int i) { y(i) = 2.0 * x(i) + y(i); });
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(2.0 * i + 1.0, static_cast<double>(y(i)));
+  }
+}
@@ -0,0 +1,131 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+TEST(MortonLayoutUnitTest, 2D_Order)
+{
+  const RAJA::MortonLayout<2> layout(4, 4);
+
+  ASSERT_EQ(16, layout.size());
+
+  /*
+   * The right-most index holds the lowest bit of each group:
+   *
+   *   0  1  4  5
+   *   2  3  6  7
+   *   8  9 12 13
+   *  10 11 14 15
+   */
+  ASSERT_EQ(0, layout(0, 0));
+  ASSERT_EQ(1, layout(0, 1));
+  ASSERT_EQ(2, layout(1, 0));
+  ASSERT_EQ(3, layout(1, 1));
+  ASSERT_EQ(4, layout(0, 2));
+  ASSERT_EQ(8, layout(2, 0));
+  ASSERT_EQ(15, layout(3, 3));
+}
+
+TEST(MortonLayoutUnitTest, 3D_Inverse)
+{
+  const RAJA::MortonLayout<3> layout(5, 7, 11);
+
+  // each dimension is padded separately: 8 * 8 * 16
+  ASSERT_EQ(1024, layout.size());
+
+  std::vector<int> hits(layout.size(), 0);
+
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 7; ++j) {
+      for (int k = 0; k < 11; ++k) {
+        RAJA::Index_type lin = layout(i, j, k);
+        ASSERT_LT(lin, layout.size());
+        hits[lin]++;
+
+        int ii, jj, kk;
+        layout.toIndices(lin, ii, jj, kk);
+        ASSERT_EQ(ii, i);
+        ASSERT_EQ(jj, j);
+        ASSERT_EQ(kk, k);
+      }
+    }
+  }
+
+  for (auto h : hits) {
+    ASSERT_LE(h, 1);
+  }
+}
+
+TEST(HilbertLayoutUnitTest, 2D_Order)
+{
+  const RAJA::HilbertLayout<2> layout(2, 2);
+
+  ASSERT_EQ(4, layout.size());
+
+  ASSERT_EQ(0, layout(0, 0));
+  ASSERT_EQ(1, layout(0, 1));
+  ASSERT_EQ(2, layout(1, 1));
+  ASSERT_EQ(3, layout(1, 0));
+}
+
+TEST(HilbertLayoutUnitTest, 3D_Adjacency)
+{
+  const RAJA::HilbertLayout<3> layout(8, 8, 8);
+
+  ASSERT_EQ(512, layout.size());
+
+  int pi = 0, pj = 0, pk = 0;
+  for (RAJA::Index_type lin = 0; lin < layout.size(); ++lin) {
+    int i, j, k;
+    layout.toIndices(lin, i, j, k);
+
+    // inverse
+    ASSERT_EQ(lin, layout(i, j, k));
+
+    // consecutive points are neighbors in exactly one dimension
+    if (lin > 0) {
+      ASSERT_EQ(1, std::abs(i - pi) + std::abs(j - pj) + std::abs(k - pk));
+    }
+    pi = i;
+    pj = j;
+    pk = k;
+  }
+}
+
+TEST(CurveLayoutUnitTest, View)
+{
+  using morton_view = RAJA::View<int, RAJA::MortonLayout<2>>;
+  using hilbert_view = RAJA::View<int, RAJA::HilbertLayout<2>>;
+
+  const int N = 6, M = 10;
+
+  RAJA::MortonLayout<2> morton(N, M);
+  RAJA::HilbertLayout<2> hilbert(N, M);
+
+  std::vector<int> a(morton.size(), -1);
+  std::vector<int> b(hilbert.size(), -1);
+
+  morton_view A(a.data(), morton);
+  hilbert_view B(b.data(), hilbert);
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      A(i, j) = i * M + j;
+      B(i, j) = i * M + j;
+    }
+  }
+
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < M; ++j) {
+      ASSERT_EQ(a[morton(i, j)], i * M + j);
+      ASSERT_EQ(b[hilbert(i, j)], i * M + j);
+    }
+  }
+}
@@ -221,6 +221,26 @@ TEST(StaticLayoutUnitTest, 3D_PermutedStaticLayout)
   }
 }
 
+TEST(StaticLayoutUnitTest, 3D_PermutedStaticLayoutToIndices)
+{
+  auto dynamic_layout =
+    RAJA::make_permuted_layout({{7, 13, 5}},
+                               RAJA::as_array<RAJA::PERM_JKI>::get());
+  using static_layout = RAJA::StaticLayout<RAJA::PERM_JKI, 7,13,5>;
+
+  // Check that both layouts invert the same way
+  for (int lin = 0; lin < 7*13*5; ++lin) {
+    int i, j, k;
+    int si, sj, sk;
+    dynamic_layout.toIndices(lin, i, j, k);
+    static_layout::toIndices(lin, si, sj, sk);
+    ASSERT_EQ(i, si);
+    ASSERT_EQ(j, sj);
+    ASSERT_EQ(k, sk);
+    ASSERT_EQ(lin, static_layout::s_oper(si, sj, sk));
+  }
+}
+
 
 TEST(StaticLayoutUnitTest, 4D_PermutedStaticLayout)
 {
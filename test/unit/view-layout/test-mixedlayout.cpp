@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+using RAJA::dynamic_extent;
+
+TEST(MixedLayoutUnitTest, StaticStrides)
+{
+  using layout = RAJA::MixedLayout<dynamic_extent, 27, 3>;
+
+  static_assert(layout::n_dims == 3, "");
+  static_assert(layout::n_dynamic == 1, "");
+  static_assert(layout::static_stride<0>::value == 81, "");
+  static_assert(layout::static_stride<1>::value == 3, "");
+  static_assert(layout::static_stride<2>::value == 1, "");
+
+  // strides left of a dynamic extent are only known at runtime
+  using inner_dynamic = RAJA::MixedLayout<8, dynamic_extent, 3>;
+  static_assert(inner_dynamic::static_stride<0>::value == dynamic_extent, "");
+  static_assert(inner_dynamic::static_stride<1>::value == 3, "");
+
+  constexpr layout l(10);
+  static_assert(l.size() == 810, "");
+
+  ASSERT_EQ(810, l.size());
+  ASSERT_EQ(10, l.sizes[0]);
+  ASSERT_EQ(27, l.sizes[1]);
+  ASSERT_EQ(81, l.strides[0]);
+  ASSERT_EQ(2 * 81 + 5 * 3 + 1, l(2, 5, 1));
+}
+
+TEST(MixedLayoutUnitTest, MatchesLayout)
+{
+  const RAJA::MixedLayout<4, dynamic_extent, 3, dynamic_extent> mixed(5, 7);
+  const RAJA::Layout<4> layout(4, 5, 3, 7);
+
+  ASSERT_EQ(layout.size(), mixed.size());
+
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      for (int k = 0; k < 3; ++k) {
+        for (int l = 0; l < 7; ++l) {
+          RAJA::Index_type lin = mixed(i, j, k, l);
+          ASSERT_EQ(layout(i, j, k, l), lin);
+
+          int ii, jj, kk, ll;
+          mixed.toIndices(lin, ii, jj, kk, ll);
+          ASSERT_EQ(i, ii);
+          ASSERT_EQ(j, jj);
+          ASSERT_EQ(k, kk);
+          ASSERT_EQ(l, ll);
+        }
+      }
+    }
+  }
+}
+
+TEST(MixedLayoutUnitTest, Projection)
+{
+  // zero-sized static extents are projected out, as in Layout
+  const RAJA::MixedLayout<dynamic_extent, 0, 4> mixed(3);
+  const RAJA::Layout<3> layout(3, 0, 4);
+
+  ASSERT_EQ(layout.size(), mixed.size());
+  ASSERT_EQ(layout(2, 5, 3), mixed(2, 5, 3));
+
+  int i, j, k;
+  mixed.toIndices(mixed(2, 5, 3), i, j, k);
+  ASSERT_EQ(2, i);
+  ASSERT_EQ(0, j);
+  ASSERT_EQ(3, k);
+}
+
+TEST(MixedLayoutUnitTest, View)
+{
+  using layout = RAJA::MixedLayout<dynamic_extent, 8, 3>;
+
+  const int N = 6;
+  std::vector<double> data(N * 8 * 3, 0.0);
+
+  RAJA::View<double, layout> v(data.data(), N);
+
+  for (int e = 0; e < N; ++e) {
+    for (int c = 0; c < 8; ++c) {
+      for (int d = 0; d < 3; ++d) {
+        v(e, c, d) = (e * 8 + c) * 3 + d;
+      }
+    }
+  }
+
+  for (int i = 0; i < N * 8 * 3; ++i) {
+    ASSERT_EQ(i, data[i]);
+  }
+}
+
+TEST(MixedLayoutUnitTest, MultiView)
+{
+  using layout = RAJA::MixedLayout<dynamic_extent, 3>;
+
+  int a1[12];
+  int a2[12];
+  int* data[2] = {a1, a2};
+
+  RAJA::MultiView<int, layout> mv(data, layout(4));
+
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      mv(0, i, j) = i * 3 + j;
+      mv(1, i, j) = -(i * 3 + j);
+    }
+  }
+
+  for (int i = 0; i < 12; ++i) {
+    ASSERT_EQ(i, a1[i]);
+    ASSERT_EQ(-i, a2[i]);
+  }
+}